@@ -0,0 +1,147 @@
+/**
+* @author - Hugh Hui
+* @file action_stream.cpp - Streaming reader for milestone4 input files built on the nlohmann SAX parser.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "action_stream.h"
+#include "json.hpp"
+#include <climits>
+#include <iostream>
+#include <string>
+
+using json = nlohmann::json;
+
+// Nesting depth of each part of the input, counting the root object as 1:
+// {"cacheManager": [ {"testCase1": [ {"add": {"key": 20, ...}} ]} ]}
+static const int ROOT_DEPTH = 1;    // keys are section names such as "cacheManager"
+static const int GROUP_DEPTH = 3;   // keys are test case names
+static const int CASE_DEPTH = 4;    // elements are action objects
+static const int ACTION_DEPTH = 5;  // keys are action names
+static const int VALUE_DEPTH = 6;   // keys are payload fields such as "key"
+
+/**
+ * @class ActionSaxHandler
+ * @brief SAX event handler that tracks its place in the input and forwards actions.
+ *
+ * Holds only the current case and action names, so its memory use does not
+ * grow with the input. Every callback returns true to keep parsing.
+ */
+class ActionSaxHandler {
+public:
+    explicit ActionSaxHandler(ActionSink& sink)
+        : sink(sink), depth(0), inCacheManager(false), caseOpen(false),
+          actionOpen(false), fieldIsKey(false), hasKey(false), actionKey(0) {}
+
+    bool null() { return scalar(); }
+    bool boolean(bool) { return scalar(); }
+    bool number_integer(json::number_integer_t val) { return integer(static_cast<long long>(val)); }
+    bool number_unsigned(json::number_unsigned_t val) {
+        return val <= static_cast<json::number_unsigned_t>(INT_MAX) ? integer(static_cast<long long>(val)) : scalar();
+    }
+    bool number_float(json::number_float_t, const json::string_t&) { return scalar(); }
+    bool string(json::string_t&) { return scalar(); }
+    bool binary(json::binary_t&) { return scalar(); }
+
+    bool start_object(std::size_t) { return startContainer(); }
+    bool start_array(std::size_t) { return startContainer(); }
+    bool end_object() { return endContainer(); }
+    bool end_array() { return endContainer(); }
+
+    bool key(json::string_t& val) {
+        if (depth == ROOT_DEPTH) {
+            inCacheManager = val == "cacheManager";
+        } else if (!inCacheManager) {
+            return true;
+        } else if (depth == GROUP_DEPTH) {
+            caseName.swap(val);
+        } else if (depth == ACTION_DEPTH) {
+            actionName.swap(val);
+            actionOpen = true;
+            hasKey = false;
+            actionKey = 0;
+        } else if (depth == VALUE_DEPTH) {
+            fieldIsKey = val == "key";
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) {
+        std::cerr << "Error parsing input file: " << ex.what() << std::endl;
+        return false;
+    }
+
+private:
+    ActionSink& sink;
+    int depth;                  // Containers currently open
+    bool inCacheManager;        // Inside the "cacheManager" section
+    bool caseOpen;              // beginTestCase was sent without its endTestCase
+    bool actionOpen;            // An action name was read and its value has not ended
+    bool fieldIsKey;            // The last payload field name was "key"
+    bool hasKey;                // The current action has a key
+    int actionKey;              // The current action's key
+    std::string caseName;       // Name of the current test case
+    std::string actionName;     // Name of the current action
+
+    // Sends the current action on
+    void finishAction() {
+        actionOpen = false;
+        fieldIsKey = false;
+        sink.action(actionName, hasKey, actionKey);
+    }
+
+    bool integer(long long val) {
+        if (inCacheManager && depth == VALUE_DEPTH && fieldIsKey && val >= INT_MIN && val <= INT_MAX) {
+            hasKey = true;
+            actionKey = static_cast<int>(val);
+            return true;
+        }
+        return scalar();
+    }
+
+    bool scalar() {
+        // An action whose value is not an object, e.g. {"isEmpty": null}
+        if (inCacheManager && depth == ACTION_DEPTH && actionOpen) {
+            finishAction();
+        }
+        fieldIsKey = false;
+        return true;
+    }
+
+    bool startContainer() {
+        ++depth;
+        if (inCacheManager && depth == CASE_DEPTH) {
+            sink.beginTestCase(caseName);
+            caseOpen = true;
+        }
+        fieldIsKey = false;
+        return true;
+    }
+
+    bool endContainer() {
+        --depth;
+        if (!inCacheManager) {
+            return true;
+        }
+        if (depth == ACTION_DEPTH && actionOpen) {
+            finishAction();
+        } else if (depth == GROUP_DEPTH && caseOpen) {
+            caseOpen = false;
+            sink.endTestCase();
+        } else if (depth < ROOT_DEPTH) {
+            inCacheManager = false;
+        }
+        return true;
+    }
+};
+
+// streamActions - parse without building a DOM, forwarding each action as it completes
+bool streamActions(std::istream& in, ActionSink& sink) {
+    ActionSaxHandler handler(sink);
+    return json::sax_parse(in, &handler);
+}
+
+// streamActions - same, reading straight from memory
+bool streamActions(const char* data, size_t size, ActionSink& sink) {
+    ActionSaxHandler handler(sink);
+    return json::sax_parse(data, data + size, &handler);
+}
@@ -0,0 +1,72 @@
+/**
+* @author - Hugh Hui
+* @file action_stream.h -  This header file declares the methods in the action_stream.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef ACTIONSTREAM_H
+#define ACTIONSTREAM_H
+
+#include <cstddef>
+#include <istream>
+#include <string_view>
+
+/**
+ * @class ActionSink
+ * @brief Receives the test cases and actions of an input file as they are read.
+ *
+ * Calls arrive in file order: `beginTestCase`, then one `action` per action
+ * in the case, then `endTestCase`. Views passed in are only valid for the
+ * duration of the call.
+ */
+class ActionSink {
+public:
+    virtual ~ActionSink() = default;
+
+    /**
+     * @brief Called when a test case's action array starts.
+     *
+     * @param caseName The name of the test case, e.g. "testCase1".
+     */
+    virtual void beginTestCase(std::string_view caseName) = 0;
+
+    /**
+     * @brief Called once per action, as soon as the action has been read.
+     *
+     * @param name The action name, e.g. "add" or "isEmpty".
+     * @param hasKey True if the action had an integer "key" field.
+     * @param key The value of the "key" field, or 0 if there was none.
+     */
+    virtual void action(std::string_view name, bool hasKey, int key) = 0;
+
+    /**
+     * @brief Called when a test case's action array ends.
+     */
+    virtual void endTestCase() = 0;
+};
+
+/**
+ * @brief Reads a milestone4 input file and passes each action on as soon as it is parsed.
+ *
+ * Uses the nlohmann SAX interface, so no JSON DOM is built and memory use
+ * does not depend on the size of the file. Only the "cacheManager" array is
+ * read; payload fields other than "key" are skipped. Actions before a syntax
+ * error have already been passed on when the error is found.
+ *
+ * @param in The input file.
+ * @param sink Receives the test cases and actions.
+ * @return True if the whole file was read, false on a syntax error (the error is written to std::cerr).
+ */
+bool streamActions(std::istream& in, ActionSink& sink);
+
+/**
+ * @brief Same as the stream version, but parses bytes already in memory, e.g. a `MappedFile`.
+ *
+ * @param data The first byte of the input.
+ * @param size The number of bytes in the input.
+ * @param sink Receives the test cases and actions.
+ * @return True if the whole input was read, false on a syntax error (the error is written to std::cerr).
+ */
+bool streamActions(const char* data, size_t size, ActionSink& sink);
+
+#endif // ACTIONSTREAM_H
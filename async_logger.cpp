@@ -0,0 +1,225 @@
+/**
+* @author - Hugh Hui
+* @file async_logger.cpp - Lock-free ring buffer logger with a batching writer thread.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "async_logger.h"
+#include <chrono>
+#include <cstring>
+
+// Spins on a full ring before yielding the core
+static const int SPINS_BEFORE_YIELD = 64;
+// Longest the writer sleeps before looking at the ring again
+static const std::chrono::milliseconds IDLE_WAIT(1);
+
+// Stream constructor: attach the buffer once it exists
+AsyncLogger::Stream::Stream(AsyncLogger& logger, unsigned char sinks, std::ostream* file)
+    : std::ostream(nullptr), buffer(logger, sinks, file) {
+    rdbuf(&buffer);
+}
+
+// Stream destructor: push whatever is left
+AsyncLogger::Stream::~Stream() {
+    buffer.pubsync();
+}
+
+// Buffer constructor: the put area is the whole text array
+AsyncLogger::Stream::Buffer::Buffer(AsyncLogger& logger, unsigned char sinks, std::ostream* file)
+    : logger(logger), sinks(sinks), file(file) {
+    setp(text, text + sizeof(text));
+}
+
+// Buffer overflow: the array is full, push it and start over
+AsyncLogger::Stream::Buffer::int_type AsyncLogger::Stream::Buffer::overflow(int_type ch) {
+    sync();
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+// Buffer sync: flush pushes the gathered text as records
+int AsyncLogger::Stream::Buffer::sync() {
+    if (pptr() > pbase())
+        logger.log(pbase(), pptr() - pbase(), sinks, file);
+    setp(text, text + sizeof(text));
+    return 0;
+}
+
+// Constructor: size the ring and start the writer
+AsyncLogger::AsyncLogger(std::ostream& console, std::ostream& file, size_t capacity, OverflowPolicy policy)
+    : console(console), file(file), policy(policy), enqueuePosition(0), dequeuePosition(0),
+      flushedPosition(0), dropped(0), written(0), sleeping(false), stopping(false) {
+    size_t size = 2;
+    while (size < capacity)
+        size *= 2;
+    mask = size - 1;
+    cells.reset(new Cell[size]);
+    for (size_t i = 0; i < size; ++i)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    writer = std::thread(&AsyncLogger::writerLoop, this);
+}
+
+// Destructor: the writer drains the ring before it exits
+AsyncLogger::~AsyncLogger() {
+    {
+        std::lock_guard<std::mutex> guard(sleepMutex);
+        stopping.store(true);
+    }
+    wakeUp.notify_one();
+    writer.join();
+}
+
+// 1. log - split into records and push them in order
+bool AsyncLogger::log(const char* text, size_t length, unsigned char sinks, std::ostream* file) {
+    bool complete = true;
+    do {
+        size_t chunk = length < RECORD_TEXT ? length : RECORD_TEXT;
+        complete &= push(text, chunk, sinks, file);
+        text += chunk;
+        length -= chunk;
+    } while (length > 0);
+    return complete;
+}
+
+// 2. flush - wait for the writer to pass everything claimed so far
+void AsyncLogger::flush() {
+    uint64_t target = enqueuePosition.load(std::memory_order_acquire);
+    wake();
+    std::unique_lock<std::mutex> guard(sleepMutex);
+    flushed.wait(guard, [&] { return flushedPosition.load(std::memory_order_acquire) >= target; });
+}
+
+// 3. getDroppedCount - Getter for the dropped record count
+uint64_t AsyncLogger::getDroppedCount() const {
+    return dropped.load(std::memory_order_relaxed);
+}
+
+// 4. getWrittenCount - Getter for the written record count
+uint64_t AsyncLogger::getWrittenCount() const {
+    return written.load(std::memory_order_relaxed);
+}
+
+// 5. push - Vyukov bounded queue enqueue
+bool AsyncLogger::push(const char* text, size_t length, unsigned char sinks, std::ostream* file) {
+    uint64_t position = enqueuePosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (int spins = 0;;) {
+        cell = &cells[position & mask];
+        uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        int64_t difference = static_cast<int64_t>(sequence - position);
+        if (difference == 0) {
+            if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        } else if (difference < 0) {
+            // Full: the writer has not freed this cell from the previous lap yet
+            if (policy == DROP) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            wake();
+            if (++spins > SPINS_BEFORE_YIELD)
+                std::this_thread::yield();
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+    cell->file = file;
+    cell->sinks = sinks;
+    cell->length = static_cast<unsigned char>(length);
+    std::memcpy(cell->text, text, length);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    // A missed wake-up only costs the writer's idle timeout
+    if (sleeping.load(std::memory_order_relaxed))
+        wake();
+    return true;
+}
+
+// 6. wake - notify the writer only if it is waiting
+void AsyncLogger::wake() {
+    if (sleeping.load()) {
+        std::lock_guard<std::mutex> guard(sleepMutex);
+        wakeUp.notify_one();
+    }
+}
+
+// 7. drain - take published records in order, at most one ring's worth per batch
+size_t AsyncLogger::drain() {
+    size_t taken = 0;
+    while (taken <= mask) {
+        Cell& cell = cells[dequeuePosition & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition + 1)
+            break; // empty, or the next producer has not finished copying
+        if (cell.sinks & CONSOLE)
+            consoleBatch.append(cell.text, cell.length);
+        if ((cell.sinks & FILE) && !cell.file)
+            fileBatch.append(cell.text, cell.length);
+        else if (cell.sinks & FILE)
+            fileBatchFor(cell.file).append(cell.text, cell.length);
+        cell.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+        ++dequeuePosition;
+        ++taken;
+    }
+    written.fetch_add(taken, std::memory_order_relaxed);
+    return taken;
+}
+
+// 8. writeBatches - one write and one flush per sink, then release flush waiters
+void AsyncLogger::writeBatches() {
+    if (!consoleBatch.empty()) {
+        console.write(consoleBatch.data(), consoleBatch.size());
+        console.flush();
+        consoleBatch.clear();
+    }
+    if (!fileBatch.empty()) {
+        file.write(fileBatch.data(), fileBatch.size());
+        file.flush();
+        fileBatch.clear();
+    }
+    // Named streams may be closed after the next flush, so none is kept
+    for (auto& batch : otherFileBatches) {
+        batch.first->write(batch.second.data(), batch.second.size());
+        batch.first->flush();
+    }
+    otherFileBatches.clear();
+    flushedPosition.store(dequeuePosition, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> guard(sleepMutex);
+    }
+    flushed.notify_all();
+}
+
+// 9. writerLoop - drain and write until stopped and empty
+void AsyncLogger::writerLoop() {
+    while (true) {
+        if (drain() > 0) {
+            writeBatches();
+            continue;
+        }
+        uint64_t claimed = enqueuePosition.load(std::memory_order_acquire);
+        if (claimed != dequeuePosition) {
+            std::this_thread::yield(); // a producer is still copying its record
+            continue;
+        }
+        if (stopping.load())
+            return;
+        std::unique_lock<std::mutex> guard(sleepMutex);
+        sleeping.store(true);
+        wakeUp.wait_for(guard, IDLE_WAIT, [&] {
+            return stopping.load() || enqueuePosition.load(std::memory_order_acquire) != dequeuePosition;
+        });
+        sleeping.store(false);
+    }
+}
+
+// 10. fileBatchFor - the current batch for a named file stream; there are only a few per batch
+std::string& AsyncLogger::fileBatchFor(std::ostream* file) {
+    for (auto& batch : otherFileBatches) {
+        if (batch.first == file)
+            return batch.second;
+    }
+    otherFileBatches.emplace_back(file, std::string());
+    return otherFileBatches.back().second;
+}
@@ -0,0 +1,235 @@
+/**
+* @author - Hugh Hui
+* @file async_logger.h -  This header file declares the methods in the async_logger.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef ASYNCLOGGER_H
+#define ASYNCLOGGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @class AsyncLogger
+ * @brief Moves console and file writes off the calling thread.
+ *
+ * Callers copy preformatted text into a bounded lock-free ring. The ring is
+ * a Vyukov multi-producer single-consumer queue with one sequence number per
+ * cell. A background thread drains it and appends each record to a batch per
+ * sink. It then writes and flushes each sink once per batch, instead of once
+ * per line as `std::endl` does.
+ *
+ * Text longer than one record is split across consecutive records. Records
+ * from one thread keep their order. Records from different threads are only
+ * ordered by when they were pushed.
+ *
+ * A file record may name its own stream, e.g. the output file of one of
+ * several file entries running at once; otherwise it goes to the file sink
+ * given to the constructor. Such a stream must stay open until a `flush`
+ * after its last record returns.
+ */
+class AsyncLogger {
+    static const size_t RECORD_TEXT = 232;  /**< Payload bytes per record; a cell fills four cache lines */
+
+public:
+    /**
+     * @enum Sink
+     * @brief Bit flags naming where a record goes.
+     */
+    enum Sink : unsigned char { CONSOLE = 1, FILE = 2 };
+
+    /**
+     * @enum OverflowPolicy
+     * @brief What `log` does when the ring is full.
+     */
+    enum OverflowPolicy {
+        BLOCK,  /**< Wait for the writer thread to make room; nothing is lost */
+        DROP    /**< Discard the record and count it; the caller never waits */
+    };
+
+    /**
+     * @class Stream
+     * @brief A std::ostream whose output goes through the logger.
+     *
+     * Text is gathered into one record and pushed on flush (`std::endl` or
+     * `std::flush`) or when the record is full, so it lines up with other
+     * records logged by the same thread.
+     */
+    class Stream : public std::ostream {
+    public:
+        /**
+         * @brief Binds a stream to a logger and a set of sinks.
+         *
+         * @param logger The logger to push records to.
+         * @param sinks Bitwise OR of Sink flags.
+         * @param file Stream for the FILE sink, or nullptr for the logger's own file.
+         */
+        Stream(AsyncLogger& logger, unsigned char sinks, std::ostream* file = nullptr);
+
+        /**
+         * @brief Pushes any text still gathered.
+         */
+        ~Stream();
+
+    private:
+        /**
+         * @class Buffer
+         * @brief The streambuf that fills a record-sized array.
+         */
+        class Buffer : public std::streambuf {
+        public:
+            Buffer(AsyncLogger& logger, unsigned char sinks, std::ostream* file);
+
+        protected:
+            int_type overflow(int_type ch) override;
+            int sync() override;
+
+        private:
+            AsyncLogger& logger;        /**< Destination logger */
+            unsigned char sinks;        /**< Destination sinks */
+            std::ostream* file;         /**< FILE sink stream; nullptr for the logger's own */
+            char text[RECORD_TEXT];     /**< Gathered text, pushed as one record */
+        };
+
+        Buffer buffer; /**< Backing streambuf */
+    };
+
+    /**
+     * @brief Starts the writer thread.
+     *
+     * @param console The console sink, usually std::cout.
+     * @param file The file sink. It must not be reopened or closed without calling `flush` first.
+     * @param capacity Number of records in the ring, rounded up to a power of two.
+     * @param policy What to do when the ring is full.
+     */
+    AsyncLogger(std::ostream& console, std::ostream& file, size_t capacity = 4096,
+                OverflowPolicy policy = BLOCK);
+
+    /**
+     * @brief Writes everything still queued, then stops the writer thread.
+     */
+    ~AsyncLogger();
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    /**
+     * @brief Queues text for the given sinks.
+     *
+     * The text is copied, so the caller may reuse its buffer right away. It is
+     * written as is; include the newline if one is wanted.
+     *
+     * @param text Pointer to the text.
+     * @param length Number of bytes.
+     * @param sinks Bitwise OR of Sink flags.
+     * @param file Stream for the FILE sink, or nullptr for the logger's own file.
+     * @return False if any part was dropped by the DROP policy.
+     */
+    bool log(const char* text, size_t length, unsigned char sinks, std::ostream* file = nullptr);
+
+    /**
+     * @brief Waits until everything queued so far is written and the sinks are flushed.
+     */
+    void flush();
+
+    /**
+     * @brief Gets the number of records discarded by the DROP policy.
+     *
+     * @return The number of dropped records.
+     */
+    uint64_t getDroppedCount() const;
+
+    /**
+     * @brief Gets the number of records the writer thread has taken off the ring.
+     *
+     * @return The number of written records.
+     */
+    uint64_t getWrittenCount() const;
+
+private:
+    /**
+     * @struct Cell
+     * @brief One ring slot; the sequence number says whose turn it is.
+     */
+    struct alignas(64) Cell {
+        std::atomic<uint64_t> sequence;     /**< == position: free for that push; == position + 1: full */
+        std::ostream* file;                 /**< FILE sink stream; nullptr for the logger's own */
+        unsigned char sinks;                /**< Destination sinks */
+        unsigned char length;               /**< Bytes used in text */
+        char text[RECORD_TEXT];             /**< Record payload */
+    };
+
+    std::ostream& console;                  /**< Console sink */
+    std::ostream& file;                     /**< File sink */
+    OverflowPolicy policy;                  /**< Full-ring behaviour */
+    size_t mask;                            /**< Ring size - 1 */
+    std::unique_ptr<Cell[]> cells;          /**< The ring */
+    alignas(64) std::atomic<uint64_t> enqueuePosition;  /**< Next position to claim (producers) */
+    alignas(64) uint64_t dequeuePosition;               /**< Next position to read (writer thread) */
+    std::atomic<uint64_t> flushedPosition;  /**< Everything before this is written and flushed */
+    std::atomic<uint64_t> dropped;          /**< Records lost to DROP */
+    std::atomic<uint64_t> written;          /**< Records taken off the ring */
+    std::atomic<bool> sleeping;             /**< Writer thread is waiting on wakeUp */
+    std::atomic<bool> stopping;             /**< Set by the destructor */
+    std::mutex sleepMutex;                  /**< Pairs with wakeUp */
+    std::condition_variable wakeUp;         /**< Signals records, flushes and shutdown */
+    std::condition_variable flushed;        /**< Signals flushedPosition moved */
+    std::string consoleBatch;               /**< Console bytes of the current batch (writer thread) */
+    std::string fileBatch;                  /**< File bytes of the current batch (writer thread) */
+    std::vector<std::pair<std::ostream*, std::string>> otherFileBatches;  /**< Bytes for streams named by records (writer thread) */
+    std::thread writer;                     /**< Background writer */
+
+    /**
+     * @brief Claims a cell and copies one record into it.
+     *
+     * @param text Pointer to at most RECORD_TEXT bytes.
+     * @param length Number of bytes.
+     * @param sinks Bitwise OR of Sink flags.
+     * @param file Stream for the FILE sink, or nullptr for the logger's own file.
+     * @return False if the record was dropped.
+     */
+    bool push(const char* text, size_t length, unsigned char sinks, std::ostream* file);
+
+    /**
+     * @brief Wakes the writer thread if it is asleep.
+     */
+    void wake();
+
+    /**
+     * @brief Moves every published record into the batches.
+     *
+     * @return Number of records taken.
+     */
+    size_t drain();
+
+    /**
+     * @brief Finds or adds the batch for a file stream named by a record.
+     *
+     * @param file The stream.
+     * @return Its bytes for the current batch.
+     */
+    std::string& fileBatchFor(std::ostream* file);
+
+    /**
+     * @brief Writes and flushes the batches, then publishes the new flushed position.
+     */
+    void writeBatches();
+
+    /**
+     * @brief Body of the writer thread.
+     */
+    void writerLoop();
+};
+
+#endif // ASYNCLOGGER_H
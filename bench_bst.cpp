@@ -0,0 +1,193 @@
+/**
+* @author - Hugh Hui
+* @file bench_bst.cpp - Times every operation of the tree engines under several key distributions and sizes.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Usage: bench_bst [maxSize] [engine]
+*
+* Sizes run from 1,000 up to maxSize (default 1,000,000; 100,000,000 is the
+* full sweep) in steps of 10x. engine is bst, splay, treap or all (default).
+* For each engine, distribution and size the program times addToTree,
+* contains, the in-, pre- and post-order traversals, clear and removeNode.
+*
+* Output is CSV on stdout, one row per phase:
+*     engine,distribution,size,phase,ops,ns_per_op,ops_per_sec,peak_rss_kb,
+*     cycles,instructions,ipc,l1d_misses,llc_misses,branch_misses
+* The hardware counts come from perf_event_open (see perf_counters.h) and are
+* left empty where the machine or perf_event_paranoid does not allow them.
+* Each engine/distribution/size runs in its own child process, so peak RSS
+* belongs to that run alone and a crash only loses its own rows.
+*
+* BinarySearchTree does not rebalance: sequential and adversarial keys turn it
+* into a chain with quadratic build time, so those runs stop at
+* DEGENERATE_LIMIT keys and larger ones are reported as skipped on stderr.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "bench_util.h"
+#include "binary_search_tree.h"
+#include "perf_counters.h"
+#include "splay_tree.h"
+#include "treap.h"
+
+// Largest chain an unbalanced engine is asked to build
+static const int DEGENERATE_LIMIT = 20000;
+
+// Keeps lookups from being optimized away
+static volatile long long sink;
+
+/**
+ * @struct PhaseResult
+ * @brief Time and hardware counts for one phase.
+ */
+struct PhaseResult {
+    const char* phase;  /**< Phase name */
+    long long ops;      /**< Operations timed */
+    PerfSample sample;  /**< Total nanoseconds and counts */
+};
+
+// Times the operations of one engine; everything runs in the calling process
+template <typename Tree>
+static std::vector<PhaseResult> runPhases(KeyDistribution distribution, int n) {
+    std::mt19937 rng(42);
+    std::vector<int> keys = insertOrder(distribution, n, rng);
+    std::vector<int> lookups = lookupOrder(distribution, keys, n, rng);
+    // Every inserted key is removed once; skew only applies to lookups
+    std::vector<int> removals = keys;
+    if (distribution == DIST_RANDOM || distribution == DIST_ZIPF)
+        std::shuffle(removals.begin(), removals.end(), rng);
+
+    std::vector<PhaseResult> results;
+    PerfCounters counters;
+    Tree tree;
+    {
+        counters.start();
+        for (int key : keys)
+            tree.addToTree(key);
+        results.push_back({ "add", n, counters.stop() });
+    }
+    {
+        long long found = 0;
+        counters.start();
+        for (int key : lookups)
+            found += tree.contains(key);
+        results.push_back({ "contains", n, counters.stop() });
+        sink = found;
+    }
+    {
+        SilenceCout silence;
+        counters.start();
+        tree.printInOrder();
+        results.push_back({ "inorder", n, counters.stop() });
+        counters.start();
+        tree.printPreOrder();
+        results.push_back({ "preorder", n, counters.stop() });
+        counters.start();
+        tree.printPostOrder();
+        results.push_back({ "postorder", n, counters.stop() });
+    }
+    {
+        counters.start();
+        tree.clear();
+        results.push_back({ "clear", n, counters.stop() });
+    }
+
+    // Rebuild untimed, then take it apart one key at a time
+    for (int key : keys)
+        tree.addToTree(key);
+    {
+        long long removed = 0;
+        counters.start();
+        for (int key : removals)
+            removed += tree.removeNode(key);
+        results.push_back({ "remove", n, counters.stop() });
+        sink = removed;
+    }
+    return results;
+}
+
+// Prints ",count", or just "," when the counter was not available
+static void printCount(long long count) {
+    if (count < 0)
+        std::printf(",");
+    else
+        std::printf(",%lld", count);
+}
+
+// Runs one configuration in a child process and prints its rows
+static void runIsolated(const char* engine, KeyDistribution distribution, int n,
+                        const std::function<std::vector<PhaseResult>()>& body) {
+    // Anything still buffered would be printed again by the child
+    std::cout.flush();
+    std::fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        std::perror("fork");
+        return;
+    }
+    if (pid == 0) {
+        std::vector<PhaseResult> results = body();
+        long rss = peakRssKb();
+        for (const PhaseResult& result : results) {
+            const PerfSample& sample = result.sample;
+            double nsPerOp = result.ops ? sample.ns / result.ops : 0.0;
+            std::printf("%s,%s,%d,%s,%lld,%.2f,%.0f,%ld", engine, distributionName(distribution), n,
+                        result.phase, result.ops, nsPerOp, nsPerOp > 0 ? 1e9 / nsPerOp : 0.0, rss);
+            printCount(sample.cycles);
+            printCount(sample.instructions);
+            if (sample.cycles > 0 && sample.instructions >= 0)
+                std::printf(",%.2f", static_cast<double>(sample.instructions) / sample.cycles);
+            else
+                std::printf(",");
+            printCount(sample.l1dMisses);
+            printCount(sample.llcMisses);
+            printCount(sample.branchMisses);
+            std::printf("\n");
+        }
+        std::fflush(stdout);
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        std::cerr << "failed: " << engine << " " << distributionName(distribution) << " " << n << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    long long maxSize = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    std::string engine = argc > 2 ? argv[2] : "all";
+    if (maxSize < 1000 || maxSize > 1000000000 ||
+        (engine != "all" && engine != "bst" && engine != "splay" && engine != "treap")) {
+        std::cerr << "Usage: bench_bst [maxSize] [bst|splay|treap|all]" << std::endl;
+        return 1;
+    }
+
+    const KeyDistribution distributions[] = { DIST_SEQUENTIAL, DIST_RANDOM, DIST_ZIPF, DIST_ADVERSARIAL };
+    std::printf("engine,distribution,size,phase,ops,ns_per_op,ops_per_sec,peak_rss_kb,"
+                "cycles,instructions,ipc,l1d_misses,llc_misses,branch_misses\n");
+    for (long long size = 1000; size <= maxSize; size *= 10) {
+        int n = static_cast<int>(size);
+        for (KeyDistribution distribution : distributions) {
+            if (engine == "all" || engine == "bst") {
+                bool degenerate = distribution == DIST_SEQUENTIAL || distribution == DIST_ADVERSARIAL;
+                if (degenerate && n > DEGENERATE_LIMIT)
+                    std::cerr << "skipped: bst " << distributionName(distribution) << " " << n << std::endl;
+                else
+                    runIsolated("bst", distribution, n, [&] { return runPhases<BinarySearchTree>(distribution, n); });
+            }
+            if (engine == "all" || engine == "splay")
+                runIsolated("splay", distribution, n, [&] { return runPhases<SplayTree>(distribution, n); });
+            if (engine == "all" || engine == "treap")
+                runIsolated("treap", distribution, n, [&] { return runPhases<Treap>(distribution, n); });
+        }
+    }
+    return 0;
+}
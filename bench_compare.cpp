@@ -0,0 +1,341 @@
+/**
+* @author - Hugh Hui
+* @file bench_compare.cpp - Runs identical operation streams against BinarySearchTree and the standard containers.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Usage: bench_compare [numberOfKeys] [replayFile]
+*
+* Containers: BinarySearchTree, std::set<int>, std::map<int, Record> (Record
+* holds the payload fields of the JSON input) and std::unordered_set<int>.
+* std::map stores the action's payload when the replay file is an op-log
+* written with --payload, and otherwise one of SYNTHETIC_RECORDS generated
+* records whose name and address are too long for std::string's inline
+* buffer, like real customer records.
+* Workloads, each an array of CompiledAction shared by every container:
+*   insert  - numberOfKeys random distinct keys (default 200,000)
+*   lookup  - as many contains, half hits and half misses
+*   mixed   - 50% contains, 25% add, 25% remove over twice the key range
+*   erase   - remove every key in random order
+*   replay  - the actions of replayFile (default milestone4.json, JSON or
+*             op-log), repeated until about a million actions have run; each
+*             test case starts from an empty container
+* insert, lookup, mixed and erase run in that order on one container.
+*
+* Every workload runs twice on fresh containers: once straight through for
+* throughput and once timing each action for latency percentiles. Memory per
+* element is the heap growth across the insert workload divided by the
+* number of keys. It is measured by counting operator new and delete through
+* malloc_usable_size, so allocator rounding is included.
+*
+* Output is CSV on stdout; container is bst, std::set, std::map or
+* std::unordered_set:
+*     container,workload,ops,ns_per_op,ops_per_sec,p50_ns,p90_ns,p99_ns,p999_ns,max_ns,bytes_per_element
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <malloc.h>
+#include <map>
+#include <new>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "json.hpp"
+#include "action_stream.h"
+#include "bench_util.h"
+#include "binary_search_tree.h"
+#include "compiled_actions.h"
+#include "mapped_file.h"
+
+// Heap bytes currently allocated through operator new
+static long long liveBytes = 0;
+
+// Out of line so the compiler does not pair inlined new/free calls and warn about a mismatch
+__attribute__((noinline)) static void* allocateCounted(std::size_t size) {
+    void* block = std::malloc(size ? size : 1);
+    if (!block)
+        throw std::bad_alloc();
+    liveBytes += static_cast<long long>(malloc_usable_size(block));
+    return block;
+}
+
+__attribute__((noinline)) static void freeCounted(void* block) {
+    if (!block)
+        return;
+    liveBytes -= static_cast<long long>(malloc_usable_size(block));
+    std::free(block);
+}
+
+void* operator new(std::size_t size) { return allocateCounted(size); }
+void operator delete(void* block) noexcept { freeCounted(block); }
+void operator delete(void* block, std::size_t) noexcept { freeCounted(block); }
+
+// Replays run until at least this many actions have been executed
+static const long long REPLAY_TARGET = 1000000;
+
+// Generated records at the front of Workloads::records; payloads follow them
+static const int SYNTHETIC_RECORDS = 1000;
+
+/**
+ * @struct Record
+ * @brief The payload fields of an "add" action in the JSON input.
+ */
+struct Record {
+    std::string fullName;
+    std::string address;
+    std::string city;
+    std::string state;
+    std::string zip;
+};
+
+// Container adapters: one overload set per operation; only std::map keeps the record
+
+static void addKey(BinarySearchTree& tree, int key, const Record&) { tree.addToTree(key); }
+static void addKey(std::set<int>& set, int key, const Record&) { set.insert(key); }
+static void addKey(std::unordered_set<int>& set, int key, const Record&) { set.insert(key); }
+static void addKey(std::map<int, Record>& map, int key, const Record& record) { map.try_emplace(key, record); }
+
+static bool removeKey(BinarySearchTree& tree, int key) { return tree.removeNode(key); }
+template <typename Container>
+static bool removeKey(Container& container, int key) { return container.erase(key) > 0; }
+
+static bool containsKey(const BinarySearchTree& tree, int key) { return tree.contains(key); }
+template <typename Container>
+static bool containsKey(const Container& container, int key) { return container.find(key) != container.end(); }
+
+static bool isEmpty(const BinarySearchTree& tree) { return tree.isEmpty(); }
+template <typename Container>
+static bool isEmpty(const Container& container) { return container.empty(); }
+
+static int sizeOf(const BinarySearchTree& tree) { return tree.getNumberOfTreeNodes(); }
+template <typename Container>
+static int sizeOf(const Container& container) { return static_cast<int>(container.size()); }
+
+// The action's payload record, or a generated one picked by key
+static inline const Record& recordFor(const CompiledAction& action, const std::vector<Record>& records) {
+    if (action.payloadIndex >= 0)
+        return records[action.payloadIndex];
+    return records[static_cast<unsigned>(action.key) % SYNTHETIC_RECORDS];
+}
+
+// Runs one action; the result only keeps the call from being optimized away
+template <typename Container>
+static inline long long runAction(Container& container, const CompiledAction& action, const std::vector<Record>& records) {
+    switch (action.opcode) {
+    case OP_ADD: addKey(container, action.key, recordFor(action, records)); return 0;
+    case OP_REMOVE: return removeKey(container, action.key);
+    case OP_CONTAINS: return containsKey(container, action.key);
+    case OP_IS_EMPTY: return isEmpty(container);
+    case OP_CLEAR: container.clear(); return 0;
+    case OP_GET_NUMBER_OF_ITEMS: return sizeOf(container);
+    default: return 0;
+    }
+}
+
+/**
+ * @struct Measurement
+ * @brief Throughput and latency of one container on one workload.
+ */
+struct Measurement {
+    long long ops = 0;
+    double totalNs = 0.0;
+    std::vector<double> latencies;  // per-action nanoseconds, from the second pass
+};
+
+static volatile long long sink;
+
+// Runs a stream straight through and adds the elapsed time
+template <typename Container>
+static void runThroughput(Container& container, const std::vector<CompiledAction>& actions,
+                          const std::vector<Record>& records, Measurement& measurement) {
+    long long result = 0;
+    BenchTimer timer;
+    for (const CompiledAction& action : actions)
+        result += runAction(container, action, records);
+    measurement.totalNs += timer.elapsedNs();
+    measurement.ops += static_cast<long long>(actions.size());
+    sink = result;
+}
+
+// Runs a stream timing every action
+template <typename Container>
+static void runLatency(Container& container, const std::vector<CompiledAction>& actions,
+                       const std::vector<Record>& records, Measurement& measurement) {
+    long long result = 0;
+    for (const CompiledAction& action : actions) {
+        auto start = std::chrono::steady_clock::now();
+        result += runAction(container, action, records);
+        measurement.latencies.push_back(
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    sink = result;
+}
+
+// Value at a percentile of sorted samples
+static double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty())
+        return 0.0;
+    size_t index = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+static void printRow(const char* container, const char* workload, Measurement& measurement, double bytesPerElement) {
+    std::sort(measurement.latencies.begin(), measurement.latencies.end());
+    double nsPerOp = measurement.ops ? measurement.totalNs / measurement.ops : 0.0;
+    std::printf("%s,%s,%lld,%.2f,%.0f,%.0f,%.0f,%.0f,%.0f,%.0f,", container, workload, measurement.ops,
+                nsPerOp, nsPerOp > 0 ? 1e9 / nsPerOp : 0.0,
+                percentile(measurement.latencies, 50), percentile(measurement.latencies, 90),
+                percentile(measurement.latencies, 99), percentile(measurement.latencies, 99.9),
+                measurement.latencies.empty() ? 0.0 : measurement.latencies.back());
+    // Memory is only measured for the insert workload
+    if (bytesPerElement >= 0.0)
+        std::printf("%.1f", bytesPerElement);
+    std::printf("\n");
+}
+
+/**
+ * @struct Workloads
+ * @brief The operation streams every container runs.
+ */
+struct Workloads {
+    std::vector<CompiledAction> insert;
+    std::vector<CompiledAction> lookup;
+    std::vector<CompiledAction> mixed;
+    std::vector<CompiledAction> erase;
+    std::vector<std::vector<CompiledAction>> replay;  // one stream per test case, ending in OP_CLEAR
+    int replayRounds = 0;
+    std::vector<Record> records;  // SYNTHETIC_RECORDS generated records, then the replay's payloads
+};
+
+template <typename Container>
+static void runContainer(const char* name, const Workloads& workloads) {
+    const char* names[] = { "insert", "lookup", "mixed", "erase" };
+    const std::vector<CompiledAction>* streams[] = { &workloads.insert, &workloads.lookup, &workloads.mixed, &workloads.erase };
+    Measurement measurements[4];
+    double bytesPerElement = 0.0;
+
+    {
+        Container container;
+        long long before = liveBytes;
+        for (int i = 0; i < 4; ++i) {
+            runThroughput(container, *streams[i], workloads.records, measurements[i]);
+            if (i == 0)
+                bytesPerElement = static_cast<double>(liveBytes - before) / workloads.insert.size();
+        }
+    }
+    {
+        Container container;
+        for (int i = 0; i < 4; ++i) {
+            measurements[i].latencies.reserve(streams[i]->size());
+            runLatency(container, *streams[i], workloads.records, measurements[i]);
+        }
+    }
+    for (int i = 0; i < 4; ++i)
+        printRow(name, names[i], measurements[i], i == 0 ? bytesPerElement : -1.0);
+
+    if (workloads.replay.empty())
+        return;
+    Measurement replay;
+    Container container;
+    for (int round = 0; round < workloads.replayRounds; ++round)
+        for (const std::vector<CompiledAction>& testCase : workloads.replay)
+            runThroughput(container, testCase, workloads.records, replay);
+    for (int round = 0; round < workloads.replayRounds; ++round)
+        for (const std::vector<CompiledAction>& testCase : workloads.replay)
+            runLatency(container, testCase, workloads.records, replay);
+    printRow(name, "replay", replay, -1.0);
+}
+
+// Compiles the replay file, JSON or op-log
+static bool loadReplay(const char* path, Workloads& workloads) {
+    MappedFile input;
+    if (!input.open(path)) {
+        std::fprintf(stderr, "Error opening replay file: %s\n", path);
+        return false;
+    }
+    CompiledProgram program;
+    bool compiled;
+    if (isOpLog(input.data(), input.size())) {
+        compiled = compileOpLog(input.data(), input.size(), program);
+    }
+    else {
+        ActionCompiler compiler(program);
+        compiled = streamActions(input.data(), input.size(), compiler);
+    }
+    if (!compiled)
+        return false;
+
+    // Payloads are compact JSON objects of the add's fields other than "key"
+    size_t firstPayload = workloads.records.size();
+    for (std::string_view payload : program.payloads) {
+        nlohmann::json fields = nlohmann::json::parse(payload.begin(), payload.end(), nullptr, false);
+        Record record;
+        if (fields.is_object()) {
+            record.fullName = fields.value("fullName", "");
+            record.address = fields.value("address", "");
+            record.city = fields.value("city", "");
+            record.state = fields.value("state", "");
+            record.zip = fields.value("zip", "");
+        }
+        workloads.records.push_back(std::move(record));
+    }
+
+    long long actionsPerRound = 0;
+    for (const CompiledTestCase& testCase : program.cases) {
+        std::vector<CompiledAction> actions = testCase.actions;
+        for (CompiledAction& action : actions)
+            if (action.payloadIndex >= 0)
+                action.payloadIndex += static_cast<int>(firstPayload);
+        actions.push_back(CompiledAction{ OP_CLEAR, 0, -1 });  // the driver clears the tree after each case
+        actionsPerRound += static_cast<long long>(actions.size());
+        workloads.replay.push_back(std::move(actions));
+    }
+    workloads.replayRounds = actionsPerRound ? static_cast<int>((REPLAY_TARGET + actionsPerRound - 1) / actionsPerRound) : 0;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int numberOfKeys = argc > 1 ? std::atoi(argv[1]) : 200000;
+    const char* replayFile = argc > 2 ? argv[2] : "milestone4.json";
+    if (numberOfKeys <= 0) {
+        std::fprintf(stderr, "Usage: bench_compare [numberOfKeys] [replayFile]\n");
+        return 1;
+    }
+
+    Workloads workloads;
+    for (int i = 0; i < SYNTHETIC_RECORDS; ++i) {
+        std::string number = std::to_string(1000 + i);
+        workloads.records.push_back(Record{ "Alexandra Montgomery-" + number, number + " Evergreen Terrace, Apt 12B",
+                                            "San Francisco", "CA", "94110" });
+    }
+    std::mt19937 rng(42);
+    std::vector<int> keys = insertOrder(DIST_RANDOM, numberOfKeys, rng);
+    for (int key : keys)
+        workloads.insert.push_back(CompiledAction{ OP_ADD, key, -1 });
+
+    std::uniform_int_distribution<int> pickKey(0, 2 * numberOfKeys - 1);
+    for (int i = 0; i < numberOfKeys; ++i)
+        workloads.lookup.push_back(CompiledAction{ OP_CONTAINS, pickKey(rng), -1 });
+
+    std::uniform_int_distribution<int> pickOp(0, 3);
+    const OpCode mix[] = { OP_CONTAINS, OP_CONTAINS, OP_ADD, OP_REMOVE };
+    for (int i = 0; i < numberOfKeys; ++i)
+        workloads.mixed.push_back(CompiledAction{ mix[pickOp(rng)], 2 * (pickKey(rng) / 2), -1 });
+
+    std::shuffle(keys.begin(), keys.end(), rng);
+    for (int key : keys)
+        workloads.erase.push_back(CompiledAction{ OP_REMOVE, key, -1 });
+
+    if (!loadReplay(replayFile, workloads))
+        std::fprintf(stderr, "Skipping the replay workload\n");
+
+    std::printf("container,workload,ops,ns_per_op,ops_per_sec,p50_ns,p90_ns,p99_ns,p999_ns,max_ns,bytes_per_element\n");
+    runContainer<BinarySearchTree>("bst", workloads);
+    runContainer<std::set<int>>("std::set", workloads);
+    runContainer<std::map<int, Record>>("std::map", workloads);
+    runContainer<std::unordered_set<int>>("std::unordered_set", workloads);
+    return 0;
+}
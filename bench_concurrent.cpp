@@ -0,0 +1,142 @@
+/**
+* @author - Hugh Hui
+* @file bench_concurrent.cpp - Throughput of the concurrent trees versus a globally locked BinarySearchTree.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Usage: bench_concurrent [maxThreads] [numberOfKeys] [operationsPerThread] [containsPercent]
+*
+* All trees are prefilled with half of the key range, then every thread runs
+* the same mix of contains/add/remove on random keys. Thread counts double
+* from 1 up to maxThreads (default: hardware concurrency).
+*/
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "binary_search_tree.h"
+#include "concurrent_bst.h"
+#include "flat_combining_bst.h"
+#include "rcu_bst.h"
+#include "sharded_bst.h"
+
+struct Workload {
+    int numberOfKeys;
+    int operationsPerThread;
+    int containsPercent;
+};
+
+// Runs one operation stream per thread and returns million operations per second
+template <typename Operation>
+static double runThreads(int threads, const Workload& workload, Operation operation) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::mt19937 rng(1234 + t);
+            std::uniform_int_distribution<int> pickKey(0, workload.numberOfKeys - 1);
+            std::uniform_int_distribution<int> pickOp(0, 99);
+            long long found = 0;
+            for (int i = 0; i < workload.operationsPerThread; ++i)
+                found += operation(pickOp(rng), pickKey(rng));
+            if (found < 0) std::cout << found; // keep the loop from being optimized out
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return threads * static_cast<double>(workload.operationsPerThread) / seconds / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+    Workload workload;
+    workload.numberOfKeys = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    workload.operationsPerThread = argc > 3 ? std::atoi(argv[3]) : 1000000;
+    workload.containsPercent = argc > 4 ? std::atoi(argv[4]) : 90;
+    if (maxThreads <= 0 || workload.numberOfKeys <= 0 || workload.operationsPerThread <= 0) {
+        std::cerr << "Usage: bench_concurrent [maxThreads] [numberOfKeys] [operationsPerThread] [containsPercent]" << std::endl;
+        return 1;
+    }
+    int updatePercent = (100 - workload.containsPercent) / 2;
+
+    std::cout << "keys=" << workload.numberOfKeys << " ops/thread=" << workload.operationsPerThread
+              << " contains=" << workload.containsPercent << "%" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "mutex Mops/s" << std::setw(16) << "olc Mops/s"
+              << std::setw(16) << "rcu Mops/s" << std::setw(16) << "sharded Mops/s"
+              << std::setw(16) << "fc Mops/s" << std::endl;
+
+    for (int threads = 1; threads <= maxThreads; threads = (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2) {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> pickKey(0, workload.numberOfKeys - 1);
+        BinarySearchTree locked;
+        ConcurrentBinarySearchTree concurrent;
+        RcuBinarySearchTree rcu;
+        ShardedBinarySearchTree sharded;
+        FlatCombiningBinarySearchTree combined;
+        for (int i = 0; i < workload.numberOfKeys / 2; ++i) {
+            int key = pickKey(rng);
+            locked.addToTree(key);
+            concurrent.addToTree(key);
+            rcu.addToTree(key);
+            sharded.addToTree(key);
+            combined.addToTree(key);
+        }
+
+        std::mutex globalLock;
+        double mutexMops = runThreads(threads, workload, [&](int op, int key) -> int {
+            std::lock_guard<std::mutex> guard(globalLock);
+            if (op < workload.containsPercent)
+                return locked.contains(key);
+            if (op < workload.containsPercent + updatePercent) {
+                locked.addToTree(key);
+                return 0;
+            }
+            return locked.removeNode(key);
+        });
+        double olcMops = runThreads(threads, workload, [&](int op, int key) -> int {
+            if (op < workload.containsPercent)
+                return concurrent.contains(key);
+            if (op < workload.containsPercent + updatePercent) {
+                concurrent.addToTree(key);
+                return 0;
+            }
+            return concurrent.removeNode(key);
+        });
+        double rcuMops = runThreads(threads, workload, [&](int op, int key) -> int {
+            if (op < workload.containsPercent)
+                return rcu.contains(key);
+            if (op < workload.containsPercent + updatePercent) {
+                rcu.addToTree(key);
+                return 0;
+            }
+            return rcu.removeNode(key);
+        });
+        double shardedMops = runThreads(threads, workload, [&](int op, int key) -> int {
+            if (op < workload.containsPercent)
+                return sharded.contains(key);
+            if (op < workload.containsPercent + updatePercent) {
+                sharded.addToTree(key);
+                return 0;
+            }
+            return sharded.removeNode(key);
+        });
+        double combinedMops = runThreads(threads, workload, [&](int op, int key) -> int {
+            if (op < workload.containsPercent)
+                return combined.contains(key);
+            if (op < workload.containsPercent + updatePercent) {
+                combined.addToTree(key);
+                return 0;
+            }
+            return combined.removeNode(key);
+        });
+
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(2)
+                  << std::setw(16) << mutexMops << std::setw(16) << olcMops << std::setw(16) << rcuMops
+                  << std::setw(16) << shardedMops << std::setw(16) << combinedMops << std::endl;
+    }
+    return 0;
+}
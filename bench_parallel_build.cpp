@@ -0,0 +1,77 @@
+/**
+* @author - Hugh Hui
+* @file bench_parallel_build.cpp - Times building a BinarySearchTree from unsorted keys on 1..N threads.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Usage: bench_parallel_build [numberOfKeys] [maxThreads]
+*
+* Keys are drawn at random with repeats. Each run is checked node for node
+* against the single-threaded build, so a speedup never hides a different tree.
+*/
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "binary_search_tree.h"
+#include "bst_parallel.h"
+
+// True if both trees have the same keys in the same shape
+static bool sameShape(const TreeNode* a, const TreeNode* b) {
+    std::vector<std::pair<const TreeNode*, const TreeNode*>> pending;
+    pending.push_back({a, b});
+    while (!pending.empty()) {
+        const TreeNode* x = pending.back().first;
+        const TreeNode* y = pending.back().second;
+        pending.pop_back();
+        if (!x || !y) {
+            if (x != y) return false;
+            continue;
+        }
+        if (x->key != y->key || x->numberOfNodes != y->numberOfNodes)
+            return false;
+        pending.push_back({x->left, y->left});
+        pending.push_back({x->right, y->right});
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int numberOfKeys = argc > 1 ? std::atoi(argv[1]) : 10000000;
+    int maxThreads = argc > 2 ? std::atoi(argv[2]) : static_cast<int>(std::thread::hardware_concurrency());
+    if (numberOfKeys <= 0 || maxThreads <= 0) {
+        std::cerr << "Usage: bench_parallel_build [numberOfKeys] [maxThreads]" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pick(0, numberOfKeys);
+    std::vector<int> keys(numberOfKeys);
+    for (int& key : keys)
+        key = pick(rng);
+
+    BinarySearchTree reference;
+    double referenceMs = 0.0;
+    std::cout << "keys=" << numberOfKeys << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "ms" << std::setw(10) << "speedup"
+              << std::setw(10) << "same" << std::endl;
+    for (int threads = 1; threads <= maxThreads; threads = (threads < maxThreads && threads * 2 > maxThreads) ? maxThreads : threads * 2) {
+        BinarySearchTree tree;
+        auto start = std::chrono::steady_clock::now();
+        buildFromUnsorted(tree, keys, threads);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (threads == 1) {
+            referenceMs = ms;
+            reference = std::move(tree);
+        }
+        bool same = threads == 1 || sameShape(reference.getRoot(), tree.getRoot());
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(1) << std::setw(12) << ms
+                  << std::setprecision(2) << std::setw(10) << referenceMs / ms
+                  << std::setw(10) << (same ? "yes" : "NO") << std::endl;
+        if (!same)
+            return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+* @author - Hugh Hui
+* @file bench_set_ops.cpp - Compares tree set algebra with a per-key contains loop.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Usage: bench_set_ops [sizeOfA] [sizeOfB]
+*
+* The baseline reconciles two trees the way callers do today: walk one tree
+* and call `contains` on the other for every key, inserting hits with
+* `addToTree`. Keys are walked in pre-order so the baseline result keeps the
+* shape of the source tree instead of degenerating into a list.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "binary_search_tree.h"
+#include "bst_set_operations.h"
+
+// Keys of a tree, root first
+static std::vector<int> preOrderKeys(const BinarySearchTree& tree) {
+    std::vector<int> keys;
+    std::vector<const TreeNode*> pending;
+    if (tree.getRoot()) pending.push_back(tree.getRoot());
+    while (!pending.empty()) {
+        const TreeNode* node = pending.back();
+        pending.pop_back();
+        keys.push_back(node->key);
+        if (node->right) pending.push_back(node->right);
+        if (node->left) pending.push_back(node->left);
+    }
+    return keys;
+}
+
+static void fillRandom(BinarySearchTree& tree, int count, int range, std::mt19937& rng) {
+    std::uniform_int_distribution<int> pick(0, range - 1);
+    while (tree.getNumberOfTreeNodes() < count)
+        tree.addToTree(pick(rng));
+}
+
+static double timeMs(const std::function<void()>& work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report(const char* name, double loopMs, double algebraMs, int loopCount, int algebraCount) {
+    std::cout << std::left << std::setw(14) << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(14) << loopMs
+              << std::setw(14) << algebraMs
+              << std::setw(10) << loopMs / algebraMs << "x"
+              << (loopCount == algebraCount ? "" : "   MISMATCH") << std::endl;
+}
+
+static void runPair(int sizeA, int sizeB, std::mt19937& rng) {
+    // Draw from a range twice the larger size so about half the keys overlap
+    int range = 2 * std::max(sizeA, sizeB);
+    BinarySearchTree a;
+    BinarySearchTree b;
+    fillRandom(a, sizeA, range, rng);
+    fillRandom(b, sizeB, range, rng);
+    std::vector<int> keysA = preOrderKeys(a);
+    std::vector<int> keysB = preOrderKeys(b);
+
+    std::cout << "|A|=" << sizeA << " |B|=" << sizeB << std::endl;
+    std::cout << std::left << std::setw(14) << "operation"
+              << std::right << std::setw(14) << "contains ms"
+              << std::setw(14) << "algebra ms"
+              << std::setw(11) << "speedup" << std::endl;
+
+    BinarySearchTree loop;
+    BinarySearchTree algebra;
+
+    double loopMs = timeMs([&] {
+        loop.clear();
+        for (int key : keysA) loop.addToTree(key);
+        for (int key : keysB)
+            if (!a.contains(key)) loop.addToTree(key);
+    });
+    double algebraMs = timeMs([&] { setUnion(a, b, algebra); });
+    report("union", loopMs, algebraMs, loop.getNumberOfTreeNodes(), algebra.getNumberOfTreeNodes());
+
+    loopMs = timeMs([&] {
+        loop.clear();
+        for (int key : keysA)
+            if (b.contains(key)) loop.addToTree(key);
+    });
+    algebraMs = timeMs([&] { setIntersection(a, b, algebra); });
+    report("intersection", loopMs, algebraMs, loop.getNumberOfTreeNodes(), algebra.getNumberOfTreeNodes());
+
+    loopMs = timeMs([&] {
+        loop.clear();
+        for (int key : keysA)
+            if (!b.contains(key)) loop.addToTree(key);
+    });
+    algebraMs = timeMs([&] { setDifference(a, b, algebra); });
+    report("difference", loopMs, algebraMs, loop.getNumberOfTreeNodes(), algebra.getNumberOfTreeNodes());
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int sizeA = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int sizeB = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    if (sizeA <= 0 || sizeB <= 0) {
+        std::cerr << "Usage: bench_set_ops [sizeOfA] [sizeOfB]" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 rng(42);
+    runPair(sizeA, sizeB, rng);
+    // Asymmetric case: a small tree reconciled against a large one
+    runPair(std::max(1, sizeA / 1000), sizeB, rng);
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+* @author - Hugh Hui
+* @file bench_splay.cpp - Compares search path lengths of BinarySearchTree and SplayTree.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Usage: bench_splay [numberOfKeys] [numberOfLookups] [zipfExponent]
+*
+* Both trees are built from the same shuffled keys, then probed with the same
+* lookup streams: one uniform over the keys and one Zipf-distributed, where
+* the hottest ranks are mapped to random keys. For each lookup the number of
+* nodes on the search path is measured before the lookup runs.
+*/
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "binary_search_tree.h"
+#include "splay_tree.h"
+
+// Number of nodes visited when searching for key
+static int pathLength(const TreeNode* node, int key) {
+    int length = 0;
+    while (node) {
+        ++length;
+        if (key == node->key)
+            break;
+        node = key < node->key ? node->left : node->right;
+    }
+    return length;
+}
+
+// Draws lookup keys with a Zipf(s) distribution over the given keys
+static std::vector<int> zipfLookups(const std::vector<int>& keys, int count, double s, std::mt19937& rng) {
+    std::vector<double> cdf(keys.size());
+    double sum = 0.0;
+    for (size_t rank = 0; rank < keys.size(); ++rank) {
+        sum += 1.0 / std::pow(static_cast<double>(rank + 1), s);
+        cdf[rank] = sum;
+    }
+    std::uniform_real_distribution<double> unit(0.0, sum);
+    std::vector<int> lookups(count);
+    for (int& key : lookups) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), unit(rng)) - cdf.begin();
+        key = keys[std::min(rank, keys.size() - 1)];
+    }
+    return lookups;
+}
+
+static std::vector<int> uniformLookups(const std::vector<int>& keys, int count, std::mt19937& rng) {
+    std::uniform_int_distribution<size_t> pick(0, keys.size() - 1);
+    std::vector<int> lookups(count);
+    for (int& key : lookups)
+        key = keys[pick(rng)];
+    return lookups;
+}
+
+static void runWorkload(const char* name, const std::vector<int>& keys, const std::vector<int>& lookups) {
+    BinarySearchTree bst;
+    SplayTree splay;
+    for (int key : keys) {
+        bst.addToTree(key);
+        splay.addToTree(key);
+    }
+
+    long long bstPath = 0;
+    long long splayPath = 0;
+    double bstNs = 0.0;
+    double splayNs = 0.0;
+    int found = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int key : lookups)
+        found += bst.contains(key);
+    bstNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int key : lookups)
+        found += splay.contains(key);
+    splayNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    // Path lengths are measured on a second pass so the timing loop stays clean
+    SplayTree replay;
+    for (int key : keys)
+        replay.addToTree(key);
+    for (int key : lookups) {
+        bstPath += pathLength(bst.getRoot(), key);
+        splayPath += pathLength(replay.getRoot(), key);
+        replay.contains(key);
+    }
+
+    double n = static_cast<double>(lookups.size());
+    std::cout << std::left << std::setw(10) << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(14) << bstPath / n
+              << std::setw(14) << splayPath / n
+              << std::setw(14) << bstNs / n
+              << std::setw(14) << splayNs / n
+              << "   (found " << found << ")" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    int numberOfKeys = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int numberOfLookups = argc > 2 ? std::atoi(argv[2]) : 1000000;
+    double exponent = argc > 3 ? std::atof(argv[3]) : 1.0;
+    if (numberOfKeys <= 0 || numberOfLookups <= 0) {
+        std::cerr << "Usage: bench_splay [numberOfKeys] [numberOfLookups] [zipfExponent]" << std::endl;
+        return 1;
+    }
+
+    std::mt19937 rng(42);
+    std::vector<int> keys(numberOfKeys);
+    for (int i = 0; i < numberOfKeys; ++i)
+        keys[i] = i * 2;
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    std::vector<int> hotOrder = keys;
+    std::shuffle(hotOrder.begin(), hotOrder.end(), rng);
+
+    std::cout << "keys=" << numberOfKeys << " lookups=" << numberOfLookups
+              << " zipf s=" << exponent << std::endl;
+    std::cout << std::left << std::setw(10) << "access"
+              << std::right << std::setw(14) << "bst path"
+              << std::setw(14) << "splay path"
+              << std::setw(14) << "bst ns/op"
+              << std::setw(14) << "splay ns/op" << std::endl;
+
+    runWorkload("uniform", keys, uniformLookups(keys, numberOfLookups, rng));
+    runWorkload("zipf", keys, zipfLookups(hotOrder, numberOfLookups, exponent, rng));
+    return 0;
+}
@@ -0,0 +1,239 @@
+/**
+* @author - Hugh Hui
+* @file bench_util.h -  Shared helpers for the benchmark programs: timing, key streams, RSS and output sinks.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef BENCHUTIL_H
+#define BENCHUTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+
+/**
+ * @class BenchTimer
+ * @brief Wall-clock stopwatch on the steady clock.
+ */
+class BenchTimer {
+public:
+    BenchTimer() : start(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Gets the time since construction.
+     *
+     * @return Elapsed nanoseconds.
+     */
+    double elapsedNs() const {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * @class NullBuffer
+ * @brief A streambuf that accepts and discards everything.
+ *
+ * Lets traversals run their formatting code without the cost of a terminal or file.
+ */
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+/**
+ * @class SilenceCout
+ * @brief Points std::cout at a NullBuffer for its lifetime.
+ *
+ * For engines whose print methods always write to std::cout.
+ */
+class SilenceCout {
+public:
+    SilenceCout() : saved(std::cout.rdbuf(&sink)) {}
+    ~SilenceCout() { std::cout.rdbuf(saved); }
+
+    SilenceCout(const SilenceCout&) = delete;
+    SilenceCout& operator=(const SilenceCout&) = delete;
+
+private:
+    NullBuffer sink;
+    std::streambuf* saved;
+};
+
+/**
+ * @brief Gets the peak resident set size of this process.
+ *
+ * @return Peak RSS in kilobytes.
+ */
+inline long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * @class ZipfGenerator
+ * @brief Draws ranks 1..n with P(k) proportional to 1/k^s in O(1) time and memory.
+ *
+ * Rejection-inversion sampling (Hoermann and Derflinger, 1996), so no table
+ * of n probabilities is needed even for n in the hundreds of millions.
+ */
+class ZipfGenerator {
+public:
+    /**
+     * @brief Sets up the sampler.
+     *
+     * @param n Number of ranks.
+     * @param s Exponent; larger values make the first ranks hotter.
+     */
+    ZipfGenerator(long long n, double s)
+        : n(n), s(s),
+          hIntegralX1(hIntegral(1.5) - 1.0),
+          hIntegralN(hIntegral(static_cast<double>(n) + 0.5)),
+          threshold(2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0))) {}
+
+    /**
+     * @brief Draws one rank.
+     *
+     * @param rng The random engine.
+     * @return A rank in 1..n.
+     */
+    template <typename Rng>
+    long long operator()(Rng& rng) {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        while (true) {
+            double u = hIntegralN + unit(rng) * (hIntegralX1 - hIntegralN);
+            double x = hIntegralInverse(u);
+            long long k = static_cast<long long>(x + 0.5);
+            if (k < 1) k = 1;
+            else if (k > n) k = n;
+            if (k - x <= threshold || u >= hIntegral(k + 0.5) - h(static_cast<double>(k)))
+                return k;
+        }
+    }
+
+private:
+    long long n;
+    double s;
+    double hIntegralX1;
+    double hIntegralN;
+    double threshold;
+
+    double h(double x) const { return std::exp(-s * std::log(x)); }
+
+    double hIntegral(double x) const {
+        double logX = std::log(x);
+        return expm1OverX((1.0 - s) * logX) * logX;
+    }
+
+    double hIntegralInverse(double x) const {
+        double t = x * (1.0 - s);
+        if (t < -1.0) t = -1.0;
+        return std::exp(log1pOverX(t) * x);
+    }
+
+    // log(1 + x) / x, accurate near 0
+    static double log1pOverX(double x) {
+        return std::fabs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+    }
+
+    // (exp(x) - 1) / x, accurate near 0
+    static double expm1OverX(double x) {
+        return std::fabs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+    }
+};
+
+/**
+ * @enum KeyDistribution
+ * @brief How a benchmark orders its keys and lookups.
+ */
+enum KeyDistribution {
+    DIST_SEQUENTIAL,    /**< Keys inserted and looked up in ascending order */
+    DIST_RANDOM,        /**< Keys inserted and looked up in random order */
+    DIST_ZIPF,          /**< Random insert order, lookups Zipf-skewed towards a few hot keys */
+    DIST_ADVERSARIAL    /**< Alternating smallest and largest remaining key, a zig-zag chain for an unbalanced tree */
+};
+
+/**
+ * @brief Gets the name of a distribution, for reports.
+ *
+ * @param distribution The distribution.
+ * @return Its name.
+ */
+inline const char* distributionName(KeyDistribution distribution) {
+    switch (distribution) {
+    case DIST_SEQUENTIAL: return "sequential";
+    case DIST_RANDOM: return "random";
+    case DIST_ZIPF: return "zipf";
+    case DIST_ADVERSARIAL: return "adversarial";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Builds the insert order for n distinct keys 0, 2, 4, ...
+ *
+ * Keys are even so that odd numbers are guaranteed misses.
+ *
+ * @param distribution The distribution.
+ * @param n Number of keys.
+ * @param rng The random engine.
+ * @return The keys in insert order.
+ */
+inline std::vector<int> insertOrder(KeyDistribution distribution, int n, std::mt19937& rng) {
+    std::vector<int> keys(n);
+    if (distribution == DIST_ADVERSARIAL) {
+        int low = 0;
+        int high = n - 1;
+        for (int i = 0; i < n; ++i)
+            keys[i] = 2 * (i % 2 == 0 ? low++ : high--);
+        return keys;
+    }
+    for (int i = 0; i < n; ++i)
+        keys[i] = 2 * i;
+    if (distribution == DIST_RANDOM || distribution == DIST_ZIPF)
+        std::shuffle(keys.begin(), keys.end(), rng);
+    return keys;
+}
+
+/**
+ * @brief Builds a stream of count lookups over the inserted keys.
+ *
+ * Zipf lookups map rank r to keys[r - 1]; the insert order is random, so the
+ * hot keys are spread over the key range.
+ *
+ * @param distribution The distribution.
+ * @param keys The keys in insert order.
+ * @param count Number of lookups.
+ * @param rng The random engine.
+ * @return The lookup keys.
+ */
+inline std::vector<int> lookupOrder(KeyDistribution distribution, const std::vector<int>& keys, int count, std::mt19937& rng) {
+    std::vector<int> lookups(count);
+    if (distribution == DIST_ZIPF) {
+        ZipfGenerator zipf(static_cast<long long>(keys.size()), 1.0);
+        for (int& key : lookups)
+            key = keys[zipf(rng) - 1];
+        return lookups;
+    }
+    if (distribution == DIST_RANDOM) {
+        std::uniform_int_distribution<size_t> pick(0, keys.size() - 1);
+        for (int& key : lookups)
+            key = keys[pick(rng)];
+        return lookups;
+    }
+    for (int i = 0; i < count; ++i)
+        lookups[i] = keys[i % keys.size()];
+    return lookups;
+}
+
+#endif // BENCHUTIL_H
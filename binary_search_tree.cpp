@@ -1,19 +1,88 @@
 #include "binary_search_tree.h"
 #include "tree_node.h"
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
 
 // File-local helpers
-static TreeNode* removeNodeHelper(TreeNode* node, int key, bool& removed);
-static int countNodes(TreeNode* node);
+static TreeNode* removeNodeHelper(TreeNode* node, int key, bool& removed, const TreeNode* arenaBegin, const TreeNode* arenaEnd);
+static void releaseNode(TreeNode* node, const TreeNode* arenaBegin, const TreeNode* arenaEnd);
+static TreeNode* buildBalanced(const std::vector<int>& keys, int low, int high);
+static TreeNode* buildBalancedParallel(const std::vector<int>& keys, int low, int high, int threads);
+static TreeNode* insertSorted(TreeNode* node, const std::vector<int>& keys, int low, int high);
 
 // Constructor: initialize empty tree
 BinarySearchTree::BinarySearchTree()
-    : root(nullptr) {}
+    : root(nullptr), arena(nullptr), arenaSize(0) {}
 
 // Destructor: delete entire tree
 BinarySearchTree::~BinarySearchTree() {
-    deleteTree(root);
+    clear();
+}
+
+// Copy constructor: deep copy through clone
+BinarySearchTree::BinarySearchTree(const BinarySearchTree& other)
+    : BinarySearchTree(other.clone()) {}
+
+// Move constructor: steal the other tree's nodes
+BinarySearchTree::BinarySearchTree(BinarySearchTree&& other) noexcept
+    : root(other.root), arena(other.arena), arenaSize(other.arenaSize) {
+    other.root = nullptr;
+    other.arena = nullptr;
+    other.arenaSize = 0;
+}
+
+// Copy assignment: clone first so self-assignment is safe
+BinarySearchTree& BinarySearchTree::operator=(const BinarySearchTree& other) {
+    if (this != &other)
+        *this = other.clone();
+    return *this;
+}
+
+// Move assignment: free our nodes, then steal the other tree's
+BinarySearchTree& BinarySearchTree::operator=(BinarySearchTree&& other) noexcept {
+    if (this != &other) {
+        clear();
+        root = other.root;
+        arena = other.arena;
+        arenaSize = other.arenaSize;
+        other.root = nullptr;
+        other.arena = nullptr;
+        other.arenaSize = 0;
+    }
+    return *this;
+}
+
+// clone - copy every node into one pre-order arena
+BinarySearchTree BinarySearchTree::clone() const {
+    BinarySearchTree copy;
+    int count = getNumberOfTreeNodes();
+    if (count == 0)
+        return copy;
+    copy.arena = new TreeNode[count];
+    copy.arenaSize = count;
+
+    // Each pending entry is a source node and the child slot its copy goes into
+    std::vector<std::pair<const TreeNode*, TreeNode**>> pending;
+    pending.push_back({root, &copy.root});
+    int next = 0;
+    while (!pending.empty()) {
+        const TreeNode* source = pending.back().first;
+        TreeNode** slot = pending.back().second;
+        pending.pop_back();
+        TreeNode* node = &copy.arena[next++];
+        node->key = source->key;
+        node->numberOfNodes = source->numberOfNodes;
+        node->height = source->height;
+        *slot = node;
+        if (source->right) pending.push_back({source->right, &node->right});
+        if (source->left) pending.push_back({source->left, &node->left});
+    }
+    return copy;
 }
 
 // 1. addToTree - Insert a key into the BST
@@ -22,16 +91,26 @@ void BinarySearchTree::addToTree(int key) {
         root = new TreeNode(key);
         return;
     }
+    // Subtree sizes are bumped on the way down; a duplicate is rare, so it
+    // pays for a second walk to undo them instead of every insert paying twice.
     TreeNode* parent = nullptr;
     TreeNode* curr = root;
     while (curr) {
         parent = curr;
+        ++curr->numberOfNodes;
         if (key < curr->key)
             curr = curr->left;
         else if (key > curr->key)
             curr = curr->right;
         else
-            return; // no duplicates
+            break;
+    }
+    if (curr) {
+        // no duplicates
+        for (TreeNode* undo = root; undo != curr; undo = key < undo->key ? undo->left : undo->right)
+            --undo->numberOfNodes;
+        --curr->numberOfNodes;
+        return;
     }
     if (key < parent->key)
         parent->left = new TreeNode(key);
@@ -42,7 +121,7 @@ void BinarySearchTree::addToTree(int key) {
 // 2. removeNode - Remove a specific key from the BST
 bool BinarySearchTree::removeNode(int key) {
     bool removed = false;
-    root = removeNodeHelper(root, key, removed);
+    root = removeNodeHelper(root, key, removed, arena, arena + arenaSize);
     return removed;
 }
 
@@ -53,7 +132,7 @@ int BinarySearchTree::getHeightOfTree() const {
 
 // 4. getNumberOfTreeNodes - Get the total number of nodes in the tree
 int BinarySearchTree::getNumberOfTreeNodes() const {
-    return countNodes(root);
+    return root ? root->numberOfNodes : 0;
 }
 
 // 5. contains - Check if a key is in the BST
@@ -84,51 +163,60 @@ bool BinarySearchTree::isEmpty() const {
 void BinarySearchTree::clear() {
     deleteTree(root);
     root = nullptr;
+    delete[] arena;
+    arena = nullptr;
+    arenaSize = 0;
 }
 
 // 9. printNodeFromTree - print only the key of a node
-void BinarySearchTree::printNodeFromTree(TreeNode* node) const {
+void BinarySearchTree::printNodeFromTree(TreeNode* node, std::ostream& out) const {
     if (!node) {
-        std::cout << "Node is null" << std::endl;
+        out << "Node is null" << std::endl;
         return;
     }
-    std::cout << "Node key: " << node->key << std::endl;
+    out << "Node key: " << node->key << std::endl;
 }
 
 // 10. printInOrder - print the BST in an in-order traversal
-void BinarySearchTree::printInOrder() const {
-    std::cout << "Performing In-order traversal" << std::endl;
-    printInOrderHelper(root);
+void BinarySearchTree::printInOrder(std::ostream& out) const {
+    out << "Performing In-order traversal" << std::endl;
+    printInOrderHelper(root, out);
 }
 
 // 11. printPreOrder - print the BST in a Pre-order traversal
-void BinarySearchTree::printPreOrder() const {
-    std::cout << "Performing Pre-order traversal" << std::endl;
-    printPreOrderHelper(root);
+void BinarySearchTree::printPreOrder(std::ostream& out) const {
+    out << "Performing Pre-order traversal" << std::endl;
+    printPreOrderHelper(root, out);
 }
 
 // 12. printPostOrder - print the BST in a Post-order traversal
-void BinarySearchTree::printPostOrder() const {
-    std::cout << "Performing Post-order traversal" << std::endl;
-    printPostOrderHelper(root);
+void BinarySearchTree::printPostOrder(std::ostream& out) const {
+    out << "Performing Post-order traversal" << std::endl;
+    printPostOrderHelper(root, out);
 }
 
 // 13. printDepthFirst - header only, no node dump
-void BinarySearchTree::printDepthFirst() const {
-    std::cout << "Performing Depth First via PreOrder traversal" << std::endl;
+void BinarySearchTree::printDepthFirst(std::ostream& out) const {
+    out << "Performing Depth First via PreOrder traversal" << std::endl;
 }
 
 // 14. printBreadthFirst - header only, no node dump
-void BinarySearchTree::printBreadthFirst() const {
-    std::cout << "Performing Breadth First traversal" << std::endl;
+void BinarySearchTree::printBreadthFirst(std::ostream& out) const {
+    out << "Performing Breadth First traversal" << std::endl;
 }
 
 // 15. deleteTree - deletes the tree starting from the specified node
 void BinarySearchTree::deleteTree(TreeNode* node) {
-    if (!node) return;
-    deleteTree(node->left);
-    deleteTree(node->right);
-    delete node;
+    // Explicit stack: a degenerate tree is as deep as it is large
+    std::vector<TreeNode*> pending;
+    if (node) pending.push_back(node);
+    while (!pending.empty()) {
+        TreeNode* curr = pending.back();
+        pending.pop_back();
+        if (curr->left) pending.push_back(curr->left);
+        if (curr->right) pending.push_back(curr->right);
+        releaseNode(curr, arena, arena + arenaSize);
+    }
 }
 
 // 16. getHeight - helper function to calculate node height
@@ -140,59 +228,113 @@ int BinarySearchTree::getHeight(TreeNode* node) const {
 }
 
 // 17. printInOrderHelper - recursive in-order
-void BinarySearchTree::printInOrderHelper(TreeNode* node) const {
+void BinarySearchTree::printInOrderHelper(TreeNode* node, std::ostream& out) const {
     if (!node) return;
-    printInOrderHelper(node->left);
-    std::cout << "Node key: " << node->key << std::endl;
-    printInOrderHelper(node->right);
+    printInOrderHelper(node->left, out);
+    out << "Node key: " << node->key << std::endl;
+    printInOrderHelper(node->right, out);
 }
 
 // 18. printPreOrderHelper - recursive pre-order
-void BinarySearchTree::printPreOrderHelper(TreeNode* node) const {
+void BinarySearchTree::printPreOrderHelper(TreeNode* node, std::ostream& out) const {
     if (!node) return;
-    std::cout << "Node key: " << node->key << std::endl;
-    printPreOrderHelper(node->left);
-    printPreOrderHelper(node->right);
+    out << "Node key: " << node->key << std::endl;
+    printPreOrderHelper(node->left, out);
+    printPreOrderHelper(node->right, out);
 }
 
 // 19. printPostOrderHelper - recursive post-order
-void BinarySearchTree::printPostOrderHelper(TreeNode* node) const {
+void BinarySearchTree::printPostOrderHelper(TreeNode* node, std::ostream& out) const {
     if (!node) return;
-    printPostOrderHelper(node->left);
-    printPostOrderHelper(node->right);
-    std::cout << "Node key: " << node->key << std::endl;
+    printPostOrderHelper(node->left, out);
+    printPostOrderHelper(node->right, out);
+    out << "Node key: " << node->key << std::endl;
+}
+
+// 20. buildFromSorted - replace the tree with a balanced build of sorted keys
+void BinarySearchTree::buildFromSorted(const std::vector<int>& keys, int threads) {
+    TreeNode* built = buildBalancedParallel(keys, 0, static_cast<int>(keys.size()), threads);
+    clear();
+    root = built;
+}
+
+// 21. addSortedKeys - insert a sorted batch in one descent
+void BinarySearchTree::addSortedKeys(const std::vector<int>& keys) {
+    root = insertSorted(root, keys, 0, static_cast<int>(keys.size()));
 }
 
 // File-local: remove a node from subtree
-static TreeNode* removeNodeHelper(TreeNode* node, int key, bool& removed) {
+static TreeNode* removeNodeHelper(TreeNode* node, int key, bool& removed, const TreeNode* arenaBegin, const TreeNode* arenaEnd) {
     if (!node) return nullptr;
     if (key < node->key) {
-        node->left = removeNodeHelper(node->left, key, removed);
+        node->left = removeNodeHelper(node->left, key, removed, arenaBegin, arenaEnd);
     } else if (key > node->key) {
-        node->right = removeNodeHelper(node->right, key, removed);
+        node->right = removeNodeHelper(node->right, key, removed, arenaBegin, arenaEnd);
     } else {
         removed = true;
         if (!node->left) {
             TreeNode* tmp = node->right;
-            delete node;
+            releaseNode(node, arenaBegin, arenaEnd);
             return tmp;
         }
         if (!node->right) {
             TreeNode* tmp = node->left;
-            delete node;
+            releaseNode(node, arenaBegin, arenaEnd);
             return tmp;
         }
         // Two children: in-order successor
         TreeNode* succ = node->right;
         while (succ->left) succ = succ->left;
         node->key = succ->key;
-        node->right = removeNodeHelper(node->right, succ->key, removed);
+        node->right = removeNodeHelper(node->right, succ->key, removed, arenaBegin, arenaEnd);
     }
+    if (removed)
+        --node->numberOfNodes;
     return node;
 }
 
-// File-local: count nodes in subtree
-static int countNodes(TreeNode* node) {
-    if (!node) return 0;
-    return 1 + countNodes(node->left) + countNodes(node->right);
+// File-local: free a node unless it lives in the clone arena, which is freed as a whole
+static void releaseNode(TreeNode* node, const TreeNode* arenaBegin, const TreeNode* arenaEnd) {
+    // std::less gives a total order even for pointers outside the arena
+    std::less<const TreeNode*> before;
+    if (!before(node, arenaBegin) && before(node, arenaEnd))
+        return;
+    delete node;
+}
+
+// File-local: build a balanced subtree from keys[low, high)
+static TreeNode* buildBalanced(const std::vector<int>& keys, int low, int high) {
+    if (low >= high) return nullptr;
+    int mid = low + (high - low) / 2;
+    TreeNode* left = buildBalanced(keys, low, mid);
+    TreeNode* right = buildBalanced(keys, mid + 1, high);
+    return new TreeNode(keys[mid], high - low, 0, left, right);
+}
+
+// File-local: build the two halves on separate threads until the thread budget or the range runs out
+static TreeNode* buildBalancedParallel(const std::vector<int>& keys, int low, int high, int threads) {
+    // Below this many keys a thread costs more than it saves
+    const int MIN_KEYS_PER_THREAD = 1 << 14;
+    if (threads <= 1 || high - low < 2 * MIN_KEYS_PER_THREAD)
+        return buildBalanced(keys, low, high);
+    // Same split as buildBalanced, so the shape does not depend on the thread count
+    int mid = low + (high - low) / 2;
+    TreeNode* left = nullptr;
+    std::thread leftBuilder([&] { left = buildBalancedParallel(keys, low, mid, threads / 2); });
+    TreeNode* right = buildBalancedParallel(keys, mid + 1, high, threads - threads / 2);
+    leftBuilder.join();
+    return new TreeNode(keys[mid], high - low, 0, left, right);
+}
+
+// File-local: merge keys[low, high) into a subtree, splitting the range at each node
+static TreeNode* insertSorted(TreeNode* node, const std::vector<int>& keys, int low, int high) {
+    if (low >= high) return node;
+    if (!node) return buildBalanced(keys, low, high);
+    int mid = static_cast<int>(std::lower_bound(keys.begin() + low, keys.begin() + high, node->key) - keys.begin());
+    int upper = (mid < high && keys[mid] == node->key) ? mid + 1 : mid; // no duplicates
+    node->left = insertSorted(node->left, keys, low, mid);
+    node->right = insertSorted(node->right, keys, upper, high);
+    node->numberOfNodes = 1 + (node->left ? node->left->numberOfNodes : 0)
+                            + (node->right ? node->right->numberOfNodes : 0);
+    return node;
 }
@@ -4,11 +4,18 @@
 * 1/14/2025 - H. Hui created file and added comments.
 * 1/15/2025 - modified by H. Hui; modified remove methods; added comments
 * 2/1/2025 - H. Hui added doxygen formatted comments
+* 10/19/2026 - H. Hui maintained subtree sizes; added buildFromSorted
+* 10/19/2026 - H. Hui added copy/move semantics and arena-backed clone
+* 10/19/2026 - H. Hui added addSortedKeys for batched inserts
+* 10/19/2026 - H. Hui added a thread count to buildFromSorted
+* 10/19/2026 - H. Hui added an output stream parameter to the print methods
 */
 
 #ifndef BINARYSEARCHTREE_H
 #define BINARYSEARCHTREE_H
 
+#include <iostream>
+#include <vector>
 #include "tree_node.h"
 
 /**
@@ -35,6 +42,47 @@ public:
      */
     ~BinarySearchTree();
 
+    /**
+     * @brief Copy constructor; deep-copies the other tree with `clone`.
+     *
+     * @param other The tree to copy.
+     */
+    BinarySearchTree(const BinarySearchTree& other);
+
+    /**
+     * @brief Move constructor; takes the other tree's nodes in O(1).
+     *
+     * @param other The tree to move from; left empty.
+     */
+    BinarySearchTree(BinarySearchTree&& other) noexcept;
+
+    /**
+     * @brief Copy assignment; frees this tree's nodes and deep-copies the other tree.
+     *
+     * @param other The tree to copy.
+     * @return Reference to this tree.
+     */
+    BinarySearchTree& operator=(const BinarySearchTree& other);
+
+    /**
+     * @brief Move assignment; frees this tree's nodes and takes the other tree's in O(1).
+     *
+     * @param other The tree to move from; left empty.
+     * @return Reference to this tree.
+     */
+    BinarySearchTree& operator=(BinarySearchTree&& other) noexcept;
+
+    /**
+     * @brief Deep-copies the tree with a single allocation.
+     *
+     * All nodes of the copy live in one contiguous arena laid out in
+     * pre-order. Nodes added to the copy later are allocated individually;
+     * arena nodes are reclaimed together when the copy is cleared or destroyed.
+     *
+     * @return An independent tree with the same shape and keys.
+     */
+    BinarySearchTree clone() const;
+
     /**
      * @brief Adds a node with the specified key to the tree.
      *
@@ -63,6 +111,8 @@ public:
     /**
      * @brief Gets the number of nodes in the tree.
      *
+     * Every node keeps `numberOfNodes` up to date, so this is O(1).
+     *
      * @return The number of nodes in the tree.
      */
     int getNumberOfTreeNodes() const;
@@ -96,57 +146,96 @@ public:
      */
     void clear();
 
+    /**
+     * @brief Replaces the contents of the tree with a balanced tree of the given keys.
+     *
+     * The middle key of each range becomes the subtree root, so the result has
+     * minimal height. Runs in O(n). With more than one thread the top-level
+     * subtrees are built in parallel; the shape is the same for any thread count.
+     *
+     * @param keys The keys to store, in strictly increasing order.
+     * @param threads Number of threads to build with (default is 1).
+     */
+    void buildFromSorted(const std::vector<int>& keys, int threads = 1);
+
+    /**
+     * @brief Inserts a batch of sorted keys in a single pass down the tree.
+     *
+     * At each node the batch is split into the keys that go left and right,
+     * so each node on the shared part of the search paths is visited once
+     * instead of once per key. Keys already in the tree are skipped. Keys
+     * that end up under the same empty child are linked in as a balanced
+     * subtree.
+     *
+     * @param keys The keys to insert, in strictly increasing order.
+     */
+    void addSortedKeys(const std::vector<int>& keys);
+
     /**
      * @brief Prints the data of a specific node.
      *
      * This function prints the key, number of nodes in the subtree, and height of the given node.
      *
      * @param node A pointer to the node whose data is to be printed.
+     * @param out The stream to print to (default is std::cout).
      */
-    void printNodeFromTree(TreeNode* node) const;
+    void printNodeFromTree(TreeNode* node, std::ostream& out = std::cout) const;
 
     /**
      * @brief Performs an in-order traversal of the tree and prints the nodes.
      *
      * In-order traversal visits the left subtree, the node, and then the right subtree.
+     *
+     * @param out The stream to print to (default is std::cout).
      */
-    void printInOrder() const;
+    void printInOrder(std::ostream& out = std::cout) const;
 
     /**
      * @brief Performs a pre-order traversal of the tree and prints the nodes.
      *
      * Pre-order traversal visits the node, the left subtree, and then the right subtree.
+     *
+     * @param out The stream to print to (default is std::cout).
      */
-    void printPreOrder() const;
+    void printPreOrder(std::ostream& out = std::cout) const;
 
     /**
      * @brief Performs a post-order traversal of the tree and prints the nodes.
      *
      * Post-order traversal visits the left subtree, the right subtree, and then the node.
+     *
+     * @param out The stream to print to (default is std::cout).
      */
-    void printPostOrder() const;
+    void printPostOrder(std::ostream& out = std::cout) const;
 
     /**
      * @brief Performs a depth-first traversal (same as pre-order traversal) and prints the nodes.
      *
      * Depth-first traversal visits the node first, then the left subtree, and then the right subtree.
+     *
+     * @param out The stream to print to (default is std::cout).
      */
-    void printDepthFirst() const;
+    void printDepthFirst(std::ostream& out = std::cout) const;
 
     /**
      * @brief Performs a breadth-first traversal of the tree and prints the nodes.
      *
      * Breadth-first traversal visits nodes level by level, from left to right.
+     *
+     * @param out The stream to print to (default is std::cout).
      */
-    void printBreadthFirst() const;
+    void printBreadthFirst(std::ostream& out = std::cout) const;
 
 private:
     TreeNode* root; /**< Pointer to the root node of the tree */
+    TreeNode* arena; /**< Block holding the nodes created by `clone`, or nullptr */
+    int arenaSize; /**< Number of nodes in `arena` */
 
     /**
      * @brief Deletes the tree starting from the specified node.
      *
-     * Recursively deletes all nodes in the tree.
+     * Iteratively deletes all nodes in the tree; arena nodes are skipped and
+     * freed with the arena by `clear`.
      *
      * @param node The starting node to begin deleting the tree.
      */
@@ -168,8 +257,9 @@ private:
      * This function is called recursively to perform an in-order traversal starting from the given node.
      *
      * @param node A pointer to the node from which to begin the in-order traversal.
+     * @param out The stream to print to.
      */
-    void printInOrderHelper(TreeNode* node) const;
+    void printInOrderHelper(TreeNode* node, std::ostream& out) const;
 
     /**
      * @brief Helper function for recursive pre-order traversal.
@@ -177,8 +267,9 @@ private:
      * This function is called recursively to perform a pre-order traversal starting from the given node.
      *
      * @param node A pointer to the node from which to begin the pre-order traversal.
+     * @param out The stream to print to.
      */
-    void printPreOrderHelper(TreeNode* node) const;
+    void printPreOrderHelper(TreeNode* node, std::ostream& out) const;
 
     /**
      * @brief Helper function for recursive post-order traversal.
@@ -186,8 +277,9 @@ private:
      * This function is called recursively to perform a post-order traversal starting from the given node.
      *
      * @param node A pointer to the node from which to begin the post-order traversal.
+     * @param out The stream to print to.
      */
-    void printPostOrderHelper(TreeNode* node) const;
+    void printPostOrderHelper(TreeNode* node, std::ostream& out) const;
 };
 
 #endif // BINARYSEARCHTREE_H
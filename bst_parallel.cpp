@@ -0,0 +1,80 @@
+/**
+* @author - Hugh Hui
+* @file bst_parallel.cpp - Multi-threaded sort, deduplicate and build for BinarySearchTree.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "bst_parallel.h"
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+// Slices smaller than this are not worth a thread
+static const size_t MIN_KEYS_PER_THREAD = 1 << 16;
+
+// File-local helpers
+static int resolveThreads(int threads);
+static void runInParallel(int tasks, const std::function<void(int)>& task);
+
+// parallelSortUnique - sort slices, merge pairwise rounds, then drop duplicates
+void parallelSortUnique(std::vector<int>& keys, int threads) {
+    int slices = resolveThreads(threads);
+    if (keys.size() / slices < MIN_KEYS_PER_THREAD)
+        slices = static_cast<int>(std::max<size_t>(1, keys.size() / MIN_KEYS_PER_THREAD));
+
+    if (slices == 1) {
+        std::sort(keys.begin(), keys.end());
+    } else {
+        std::vector<int> buffer(keys.size());
+        std::vector<int>* source = &keys;
+        std::vector<int>* target = &buffer;
+        // Run i is [runs[i], runs[i + 1])
+        std::vector<size_t> runs;
+        for (int i = 0; i <= slices; ++i)
+            runs.push_back(keys.size() * i / slices);
+        runInParallel(slices, [&](int i) {
+            std::sort(keys.begin() + runs[i], keys.begin() + runs[i + 1]);
+        });
+
+        // Each round merges pairs of runs of `width` slices into the other buffer
+        for (int width = 1; width < slices; width *= 2) {
+            int pairs = (slices + 2 * width - 1) / (2 * width);
+            runInParallel(pairs, [&](int pair) {
+                int first = pair * 2 * width;
+                int middle = std::min(first + width, slices);
+                int last = std::min(first + 2 * width, slices);
+                std::merge(source->begin() + runs[first], source->begin() + runs[middle],
+                           source->begin() + runs[middle], source->begin() + runs[last],
+                           target->begin() + runs[first]);
+            });
+            std::swap(source, target);
+        }
+        if (source != &keys)
+            keys.swap(buffer);
+    }
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
+// buildFromUnsorted - parallel sort and dedupe, then parallel balanced build
+void buildFromUnsorted(BinarySearchTree& tree, std::vector<int> keys, int threads) {
+    threads = resolveThreads(threads);
+    parallelSortUnique(keys, threads);
+    tree.buildFromSorted(keys, threads);
+}
+
+// File-local: 0 means one thread per hardware thread
+static int resolveThreads(int threads) {
+    if (threads > 0)
+        return threads;
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? static_cast<int>(hardware) : 1;
+}
+
+// File-local: run task(0..tasks-1), the last one on the calling thread
+static void runInParallel(int tasks, const std::function<void(int)>& task) {
+    std::vector<std::thread> workers;
+    for (int i = 0; i + 1 < tasks; ++i)
+        workers.emplace_back(task, i);
+    task(tasks - 1);
+    for (std::thread& worker : workers)
+        worker.join();
+}
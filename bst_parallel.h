@@ -0,0 +1,257 @@
+/**
+* @author - Hugh Hui
+* @file bst_parallel.h -  This header file declares the methods in the bst_parallel.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef BSTPARALLEL_H
+#define BSTPARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include "binary_search_tree.h"
+#include "tree_iterator.h"
+#include "work_stealing_pool.h"
+
+/**
+ * @brief Sorts keys and removes duplicates using several threads.
+ *
+ * Equal slices are sorted on separate threads and then merged pairwise, with
+ * the merges of each round also running in parallel. Duplicates are dropped
+ * in a final linear pass.
+ *
+ * @param keys The keys to sort; left strictly increasing.
+ * @param threads Number of threads (0 means one per hardware thread).
+ */
+void parallelSortUnique(std::vector<int>& keys, int threads = 0);
+
+/**
+ * @brief Replaces a tree's contents with a balanced tree of unsorted keys, using several threads.
+ *
+ * Sorts and deduplicates with `parallelSortUnique`, then builds with
+ * `BinarySearchTree::buildFromSorted` on the same number of threads. The
+ * result is node for node the tree that a single-threaded sort followed by
+ * `buildFromSorted` produces.
+ *
+ * @param tree The tree to fill; previous contents are deleted.
+ * @param keys The keys to store, in any order and possibly repeated.
+ * @param threads Number of threads (0 means one per hardware thread).
+ */
+void buildFromUnsorted(BinarySearchTree& tree, std::vector<int> keys, int threads = 0);
+
+/**
+ * @struct ReduceSegment
+ * @brief A run of consecutive keys: a whole subtree, or one node's own key.
+ *
+ * Implementation detail of `parallelReduce`.
+ */
+struct ReduceSegment {
+    const TreeNode* node;   /**< Subtree root, or the node whose key this is */
+    bool wholeSubtree;      /**< True for every key under node, false for node->key alone */
+};
+
+/**
+ * @struct ReducePart
+ * @brief One task's share of a reduction: a large subtree, or a batch of small segments.
+ *
+ * Implementation detail of `parallelReduce`.
+ */
+template <typename T>
+struct ReducePart {
+    explicit ReducePart(const T& identity) : value(identity) {}
+
+    const TreeNode* subtree = nullptr;      /**< A subtree above the grain, reduced by splitting again */
+    std::vector<ReduceSegment> segments;    /**< Otherwise small segments, folded in order */
+    int keys = 0;                           /**< Keys in segments */
+    T value;                                /**< The task's result */
+};
+
+/**
+ * @brief Gets the number of keys under a node.
+ *
+ * @param node The subtree root, possibly nullptr.
+ * @return Its numberOfNodes, 0 for nullptr.
+ */
+inline int reduceSizeOf(const TreeNode* node) {
+    return node ? node->numberOfNodes : 0;
+}
+
+/**
+ * @brief Folds segments in order on the calling thread.
+ *
+ * Implementation detail of `parallelReduce`.
+ */
+template <typename T, typename Fold>
+T foldSegments(const std::vector<ReduceSegment>& segments, const T& identity, const Fold& fn) {
+    T accumulator = identity;
+    for (const ReduceSegment& segment : segments) {
+        if (!segment.wholeSubtree) {
+            accumulator = fn(accumulator, segment.node->key);
+            continue;
+        }
+        for (InOrderIterator it(segment.node); it.hasNext();)
+            accumulator = fn(accumulator, it.next());
+    }
+    return accumulator;
+}
+
+/**
+ * @brief Folds the keys under a node in order, splitting them across pool tasks.
+ *
+ * Implementation detail of `parallelReduce`.
+ */
+template <typename T, typename Fold, typename Combine>
+T parallelReduceSubtree(const TreeNode* node, int grain, const T& identity,
+                        const Fold& fn, const Combine& combine, WorkStealingPool& pool) {
+    if (reduceSizeOf(node) <= grain)
+        return foldSegments(std::vector<ReduceSegment>{ { node, true } }, identity, fn);
+
+    // Parts before the current subtree in order; parts after it, nearest last.
+    // Deque elements stay put, so running tasks can write into them.
+    std::deque<ReducePart<T>> before;
+    std::deque<ReducePart<T>> after;
+    ReducePart<T>* openBefore = nullptr;
+    ReducePart<T>* openAfter = nullptr;
+    std::atomic<int> pending(0);
+
+    auto launch = [&](ReducePart<T>& part) {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        pool.spawn([&part, grain, &identity, &fn, &combine, &pool, &pending] {
+            if (part.subtree)
+                part.value = parallelReduceSubtree(part.subtree, grain, identity, fn, combine, pool);
+            else
+                part.value = foldSegments(part.segments, identity, fn);
+            pending.fetch_sub(1, std::memory_order_release);
+        });
+    };
+    auto closeAfter = [&] {
+        if (openAfter) {
+            // Segments after the current subtree are found outermost first
+            std::reverse(openAfter->segments.begin(), openAfter->segments.end());
+            launch(*openAfter);
+            openAfter = nullptr;
+        }
+    };
+    auto addBefore = [&](const TreeNode* subtree, bool whole) {
+        int keys = whole ? reduceSizeOf(subtree) : 1;
+        if (keys == 0)
+            return;
+        if (keys > grain) {
+            if (openBefore)
+                launch(*openBefore);
+            openBefore = nullptr;
+            before.emplace_back(identity);
+            before.back().subtree = subtree;
+            launch(before.back());
+            return;
+        }
+        if (!openBefore) {
+            before.emplace_back(identity);
+            openBefore = &before.back();
+        }
+        openBefore->segments.push_back({ subtree, whole });
+        openBefore->keys += keys;
+        if (openBefore->keys >= grain) {
+            launch(*openBefore);
+            openBefore = nullptr;
+        }
+    };
+    auto addAfter = [&](const TreeNode* subtree, bool whole) {
+        int keys = whole ? reduceSizeOf(subtree) : 1;
+        if (keys == 0)
+            return;
+        if (keys > grain) {
+            closeAfter();
+            after.emplace_front(identity);
+            after.front().subtree = subtree;
+            launch(after.front());
+            return;
+        }
+        if (!openAfter) {
+            after.emplace_front(identity);
+            openAfter = &after.front();
+        }
+        openAfter->segments.push_back({ subtree, whole });
+        openAfter->keys += keys;
+        if (openAfter->keys >= grain)
+            closeAfter();
+    };
+
+    // Walk down the larger child; the smaller side and the node's key become parts.
+    // Each large part is at most half its parent, so splitting again nests only
+    // log(n) deep, and a chain is walked in a loop rather than by recursion.
+    while (reduceSizeOf(node) > grain) {
+        if (reduceSizeOf(node->left) >= reduceSizeOf(node->right)) {
+            addAfter(node->right, true);
+            addAfter(node, false);
+            node = node->left;
+        } else {
+            addBefore(node->left, true);
+            addBefore(node, false);
+            node = node->right;
+        }
+    }
+    addBefore(node, true);
+    if (openBefore)
+        launch(*openBefore);
+    closeAfter();
+    pool.waitFor(pending);
+
+    T result = identity;
+    for (const ReducePart<T>& part : before)
+        result = combine(result, part.value);
+    for (const ReducePart<T>& part : after)
+        result = combine(result, part.value);
+    return result;
+}
+
+/**
+ * @brief Reduces every key of a tree on a work-stealing pool.
+ *
+ * The keys are cut at subtree boundaries found with numberOfNodes. Starting
+ * at the root, the walk goes down the larger child and hands the smaller
+ * child and the node's own key to tasks: subtrees above the grain are split
+ * again the same way, smaller ones are batched up to the grain and folded by
+ * an iterator rooted at each subtree. No piece seeks from the root, and a
+ * skewed tree is walked in a loop rather than by recursion. Pieces are
+ * combined left to right, so `combine` only has to be associative. The tree
+ * must not change while this runs.
+ *
+ * @param tree The tree to reduce.
+ * @param identity Starting value of every piece; must be neutral for `combine`.
+ * @param fn Folds one key into a piece's value: T fn(const T&, int key).
+ * @param combine Merges the values of two adjacent pieces: T combine(const T& left, const T& right).
+ * @param pool The pool to run on.
+ * @return The reduced value, or `identity` for an empty tree.
+ */
+template <typename T, typename Fold, typename Combine>
+T parallelReduce(const BinarySearchTree& tree, const T& identity, Fold fn, Combine combine, WorkStealingPool& pool) {
+    // Several pieces per thread so stealing can even out uneven work
+    const int PIECES_PER_THREAD = 8;
+    const int MIN_GRAIN = 1024;
+    int count = tree.getNumberOfTreeNodes();
+    int grain = count / (pool.getNumberOfThreads() * PIECES_PER_THREAD);
+    if (grain < MIN_GRAIN)
+        grain = MIN_GRAIN;
+    return parallelReduceSubtree(tree.getRoot(), grain, identity, fn, combine, pool);
+}
+
+/**
+ * @brief Calls a function on every key of a tree on a work-stealing pool.
+ *
+ * Same splitting as `parallelReduce`. Keys are visited in no particular order
+ * across threads, so `fn` must be safe to call concurrently.
+ *
+ * @param tree The tree to walk.
+ * @param fn Called once per key: void fn(int key).
+ * @param pool The pool to run on.
+ */
+template <typename Function>
+void parallelForEach(const BinarySearchTree& tree, Function fn, WorkStealingPool& pool) {
+    parallelReduce(tree, 0, [&fn](int, int key) { fn(key); return 0; },
+                   [](int, int) { return 0; }, pool);
+}
+
+#endif // BSTPARALLEL_H
@@ -0,0 +1,103 @@
+/**
+* @author - Hugh Hui
+* @file bst_set_operations.cpp - Union, intersection and difference of two BinarySearchTrees.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "bst_set_operations.h"
+#include "tree_iterator.h"
+#include <vector>
+
+// File-local helpers
+static bool preferProbing(int smallSize, int largeSize);
+static void probeKeys(const BinarySearchTree& small, const BinarySearchTree& large, bool keepIfFound, std::vector<int>& keys);
+
+// 1. setUnion - merge both in-order streams, dropping duplicates
+void setUnion(const BinarySearchTree& a, const BinarySearchTree& b, BinarySearchTree& result) {
+    std::vector<int> keys;
+    keys.reserve(a.getNumberOfTreeNodes() + b.getNumberOfTreeNodes());
+    InOrderIterator left(a.getRoot());
+    InOrderIterator right(b.getRoot());
+    while (left.hasNext() && right.hasNext()) {
+        if (left.peek() < right.peek()) {
+            keys.push_back(left.next());
+        } else if (right.peek() < left.peek()) {
+            keys.push_back(right.next());
+        } else {
+            keys.push_back(left.next());
+            right.next();
+        }
+    }
+    while (left.hasNext()) keys.push_back(left.next());
+    while (right.hasNext()) keys.push_back(right.next());
+    result.buildFromSorted(keys);
+}
+
+// 2. setIntersection - merge, or probe the larger tree with the smaller one
+void setIntersection(const BinarySearchTree& a, const BinarySearchTree& b, BinarySearchTree& result) {
+    int sizeA = a.getNumberOfTreeNodes();
+    int sizeB = b.getNumberOfTreeNodes();
+    std::vector<int> keys;
+    if (preferProbing(sizeA, sizeB)) {
+        probeKeys(a, b, true, keys);
+    } else if (preferProbing(sizeB, sizeA)) {
+        probeKeys(b, a, true, keys);
+    } else {
+        keys.reserve(sizeA < sizeB ? sizeA : sizeB);
+        InOrderIterator left(a.getRoot());
+        InOrderIterator right(b.getRoot());
+        while (left.hasNext() && right.hasNext()) {
+            if (left.peek() < right.peek()) {
+                left.next();
+            } else if (right.peek() < left.peek()) {
+                right.next();
+            } else {
+                keys.push_back(left.next());
+                right.next();
+            }
+        }
+    }
+    result.buildFromSorted(keys);
+}
+
+// 3. setDifference - merge, or probe b when a is the small side
+void setDifference(const BinarySearchTree& a, const BinarySearchTree& b, BinarySearchTree& result) {
+    int sizeA = a.getNumberOfTreeNodes();
+    int sizeB = b.getNumberOfTreeNodes();
+    std::vector<int> keys;
+    if (preferProbing(sizeA, sizeB)) {
+        probeKeys(a, b, false, keys);
+    } else {
+        keys.reserve(sizeA);
+        InOrderIterator left(a.getRoot());
+        InOrderIterator right(b.getRoot());
+        while (left.hasNext()) {
+            if (!right.hasNext() || left.peek() < right.peek()) {
+                keys.push_back(left.next());
+            } else if (right.peek() < left.peek()) {
+                right.next();
+            } else {
+                left.next();
+                right.next();
+            }
+        }
+    }
+    result.buildFromSorted(keys);
+}
+
+// File-local: probing m keys costs about m * log2(n) steps versus n + m for a merge
+static bool preferProbing(int smallSize, int largeSize) {
+    int depth = 1;
+    for (int n = largeSize; n > 1; n >>= 1)
+        ++depth;
+    return static_cast<long long>(smallSize) * depth * 2 < static_cast<long long>(largeSize);
+}
+
+// File-local: walk the small tree in order and keep keys by membership in the large one
+static void probeKeys(const BinarySearchTree& small, const BinarySearchTree& large, bool keepIfFound, std::vector<int>& keys) {
+    InOrderIterator it(small.getRoot());
+    while (it.hasNext()) {
+        int key = it.next();
+        if (large.contains(key) == keepIfFound)
+            keys.push_back(key);
+    }
+}
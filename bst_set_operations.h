@@ -0,0 +1,51 @@
+/**
+* @author - Hugh Hui
+* @file bst_set_operations.h -  This header file declares the methods in the bst_set_operations.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef BSTSETOPERATIONS_H
+#define BSTSETOPERATIONS_H
+
+#include "binary_search_tree.h"
+
+/**
+ * @brief Computes the union of two trees into a balanced result.
+ *
+ * Both trees are streamed in order and merged, so this runs in O(n + m).
+ * `result` may be one of the inputs.
+ *
+ * @param a The first tree.
+ * @param b The second tree.
+ * @param result Receives every key that is in `a` or `b`.
+ */
+void setUnion(const BinarySearchTree& a, const BinarySearchTree& b, BinarySearchTree& result);
+
+/**
+ * @brief Computes the intersection of two trees into a balanced result.
+ *
+ * Runs in O(n + m) by merging in-order streams. When one tree is much
+ * smaller, its keys are probed in the larger tree instead, which costs
+ * O(m * h) for m small keys and a larger tree of height h.
+ * `result` may be one of the inputs.
+ *
+ * @param a The first tree.
+ * @param b The second tree.
+ * @param result Receives every key that is in both `a` and `b`.
+ */
+void setIntersection(const BinarySearchTree& a, const BinarySearchTree& b, BinarySearchTree& result);
+
+/**
+ * @brief Computes the difference of two trees into a balanced result.
+ *
+ * Runs in O(n + m) by merging in-order streams. When `a` is much smaller
+ * than `b`, the keys of `a` are probed in `b` instead.
+ * `result` may be one of the inputs.
+ *
+ * @param a The tree to take keys from.
+ * @param b The tree whose keys are excluded.
+ * @param result Receives every key that is in `a` but not in `b`.
+ */
+void setDifference(const BinarySearchTree& a, const BinarySearchTree& b, BinarySearchTree& result);
+
+#endif // BSTSETOPERATIONS_H
@@ -0,0 +1,68 @@
+/**
+* @author - Hugh Hui
+* @file compiled_actions.cpp - Turns parsed test cases into flat opcode arrays.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "compiled_actions.h"
+#include <iostream>
+
+// Constructor: remember the destination
+ActionCompiler::ActionCompiler(CompiledProgram& program)
+    : program(program) {}
+
+// 1. beginTestCase - start a new case
+void ActionCompiler::beginTestCase(std::string_view caseName) {
+    program.cases.emplace_back();
+    program.cases.back().name.assign(caseName.data(), caseName.size());
+}
+
+// 2. action - look the name up once and store the opcode
+void ActionCompiler::action(std::string_view name, bool hasKey, int key) {
+    OpCode op;
+    if (program.cases.empty() || !opCodeForAction(name, op))
+        return;
+    if ((op == OP_ADD || op == OP_REMOVE || op == OP_CONTAINS) && !hasKey) {
+        std::cerr << "Missing key for action: " << name << std::endl;
+        return;
+    }
+    program.cases.back().actions.push_back(CompiledAction{ op, key, -1 });
+}
+
+// 3. endTestCase - nothing to finish
+void ActionCompiler::endTestCase() {}
+
+// 4. compileOpLog - records map one to one onto compiled actions; framing is checked as replayOpLog does
+bool compileOpLog(const char* data, size_t size, CompiledProgram& program) {
+    OpLogReader reader(data, size);
+    OpLogRecord record;
+    bool caseOpen = false;
+    while (reader.next(record)) {
+        if (record.op == OP_BEGIN_CASE) {
+            caseOpen = true;
+            program.cases.emplace_back();
+            program.cases.back().name.assign(record.name.data(), record.name.size());
+        }
+        else if (!caseOpen) {
+            std::cerr << "Error reading op-log: record outside a test case" << std::endl;
+            return false;
+        }
+        else if (record.op == OP_END_CASE) {
+            caseOpen = false;
+        }
+        else {
+            int payloadIndex = -1;
+            if (!record.payload.empty()) {
+                payloadIndex = static_cast<int>(program.payloads.size());
+                program.payloads.push_back(record.payload);
+            }
+            program.cases.back().actions.push_back(CompiledAction{ record.op, record.key, payloadIndex });
+        }
+    }
+    if (reader.hasError())
+        return false;
+    if (caseOpen) {
+        std::cerr << "Error reading op-log: unterminated test case" << std::endl;
+        return false;
+    }
+    return true;
+}
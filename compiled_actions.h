@@ -0,0 +1,86 @@
+/**
+* @author - Hugh Hui
+* @file compiled_actions.h -  This header file declares the methods in the compiled_actions.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef COMPILEDACTIONS_H
+#define COMPILEDACTIONS_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "action_stream.h"
+#include "op_log.h"
+
+/**
+ * @struct CompiledAction
+ * @brief One action, ready to run without looking at its name again.
+ */
+struct CompiledAction {
+    OpCode opcode;      /**< What to do; never OP_BEGIN_CASE or OP_END_CASE */
+    int key;            /**< Key for OP_ADD, OP_REMOVE and OP_CONTAINS, 0 otherwise */
+    int payloadIndex;   /**< Index into CompiledProgram::payloads, or -1 for none */
+};
+
+/**
+ * @struct CompiledTestCase
+ * @brief The actions of one test case, in file order.
+ */
+struct CompiledTestCase {
+    std::string name;                       /**< Test case name, e.g. "testCase1" */
+    std::vector<CompiledAction> actions;    /**< Flat action array */
+};
+
+/**
+ * @struct CompiledProgram
+ * @brief Every test case of an input file.
+ *
+ * Compiling pays the parsing and name lookup cost once. Running the program
+ * again (benchmarks, replays) is a loop over the flat action arrays.
+ */
+struct CompiledProgram {
+    std::vector<CompiledTestCase> cases;        /**< Test cases in file order */
+    std::vector<std::string_view> payloads;     /**< Views into the op-log the program came from */
+};
+
+/**
+ * @class ActionCompiler
+ * @brief An ActionSink that appends what it receives to a CompiledProgram.
+ *
+ * Feed it with `streamActions` to compile a JSON input. Actions without an
+ * opcode are left out, as the driver ignores them anyway. Actions that need a
+ * key but have none are left out with a warning on std::cerr.
+ */
+class ActionCompiler : public ActionSink {
+public:
+    /**
+     * @brief Compiles into the given program, after whatever it already holds.
+     *
+     * @param program The program to append to.
+     */
+    explicit ActionCompiler(CompiledProgram& program);
+
+    void beginTestCase(std::string_view caseName) override;
+    void action(std::string_view name, bool hasKey, int key) override;
+    void endTestCase() override;
+
+private:
+    CompiledProgram& program;   /**< Destination */
+};
+
+/**
+ * @brief Compiles an op-log held in memory.
+ *
+ * Payloads are kept as views into the log, so the bytes must outlive the program.
+ *
+ * @param data The first byte of the log.
+ * @param size The number of bytes in the log.
+ * @param program Receives the test cases, after whatever it already holds.
+ * @return True if the whole log was read, false if it is malformed, has a record outside a test case
+ *         or ends inside one, as for replayOpLog (the error is written to std::cerr).
+ */
+bool compileOpLog(const char* data, size_t size, CompiledProgram& program);
+
+#endif // COMPILEDACTIONS_H
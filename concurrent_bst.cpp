@@ -0,0 +1,300 @@
+/**
+* @author - Hugh Hui
+* @file concurrent_bst.cpp - Thread-safe binary search tree using optimistic lock coupling.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "concurrent_bst.h"
+#include "epoch_reclamation.h"
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Version word layout
+static const uint64_t OBSOLETE = 1;
+static const uint64_t LOCKED = 2;
+
+// File-local helpers
+static bool readLock(const ConcurrentNode* node, uint64_t& version);
+static bool validate(const ConcurrentNode* node, uint64_t version);
+static bool upgrade(ConcurrentNode* node, uint64_t version);
+static void writeUnlock(ConcurrentNode* node);
+static void writeUnlockObsolete(ConcurrentNode* node);
+static void deleteNode(void* node);
+
+// ConcurrentNode constructor
+ConcurrentNode::ConcurrentNode(int k)
+    : version(0), key(k), deleted(false), left(nullptr), right(nullptr) {}
+
+// Constructor: initialize empty tree
+ConcurrentBinarySearchTree::ConcurrentBinarySearchTree()
+    : head(0) {}
+
+// Destructor: delete entire tree
+ConcurrentBinarySearchTree::~ConcurrentBinarySearchTree() {
+    clear();
+}
+
+// 1. addToTree - link a new leaf under a locked parent, or revive a routing node
+void ConcurrentBinarySearchTree::addToTree(int key) {
+    EpochGuard guard;
+    ConcurrentNode* fresh = nullptr;
+    while (true) {
+        Position pos;
+        if (!locate(key, pos, true))
+            continue;
+
+        if (pos.node) {
+            bool deleted = pos.node->deleted.load(std::memory_order_relaxed);
+            if (!validate(pos.node, pos.nodeVersion))
+                continue;
+            if (deleted) {
+                if (!upgrade(pos.node, pos.nodeVersion))
+                    continue;
+                pos.node->deleted.store(false, std::memory_order_relaxed);
+                writeUnlock(pos.node);
+            }
+            delete fresh;
+            return; // no duplicates
+        }
+
+        if (!fresh)
+            fresh = new ConcurrentNode(key);
+        if (!upgrade(pos.parent, pos.parentVersion))
+            continue;
+        if (pos.parent == &head)
+            head.left.store(fresh, std::memory_order_release);
+        else if (key < pos.parent->key)
+            pos.parent->left.store(fresh, std::memory_order_release);
+        else
+            pos.parent->right.store(fresh, std::memory_order_release);
+        writeUnlock(pos.parent);
+        return;
+    }
+}
+
+// 2. removeNode - unlink a node with at most one child, otherwise mark it deleted
+bool ConcurrentBinarySearchTree::removeNode(int key) {
+    EpochGuard guard;
+    while (true) {
+        Position pos;
+        if (!locate(key, pos, true))
+            continue;
+        if (!pos.node)
+            return false;
+
+        ConcurrentNode* node = pos.node;
+        bool deleted = node->deleted.load(std::memory_order_relaxed);
+        bool twoChildren = node->left.load(std::memory_order_acquire) && node->right.load(std::memory_order_acquire);
+        if (!validate(node, pos.nodeVersion))
+            continue;
+        if (deleted)
+            return false;
+
+        if (twoChildren) {
+            if (!upgrade(node, pos.nodeVersion))
+                continue;
+            node->deleted.store(true, std::memory_order_relaxed);
+            writeUnlock(node);
+            return true;
+        }
+        if (tryUnlink(pos.parent, pos.parentVersion, node, pos.nodeVersion))
+            return true;
+    }
+}
+
+// 3. contains - optimistic walk, no locks taken
+bool ConcurrentBinarySearchTree::contains(int key) const {
+    EpochGuard guard;
+    while (true) {
+        Position pos;
+        if (!locate(key, pos, false))
+            continue;
+        if (!pos.node)
+            return false;
+        bool deleted = pos.node->deleted.load(std::memory_order_relaxed);
+        if (!validate(pos.node, pos.nodeVersion))
+            continue;
+        return !deleted;
+    }
+}
+
+// 4. getHeightOfTree - level-by-level count
+int ConcurrentBinarySearchTree::getHeightOfTree() const {
+    int height = 0;
+    std::vector<const ConcurrentNode*> level;
+    std::vector<const ConcurrentNode*> nextLevel;
+    if (const ConcurrentNode* root = head.left.load(std::memory_order_acquire))
+        level.push_back(root);
+    while (!level.empty()) {
+        ++height;
+        nextLevel.clear();
+        for (const ConcurrentNode* node : level) {
+            if (const ConcurrentNode* l = node->left.load(std::memory_order_acquire)) nextLevel.push_back(l);
+            if (const ConcurrentNode* r = node->right.load(std::memory_order_acquire)) nextLevel.push_back(r);
+        }
+        level.swap(nextLevel);
+    }
+    return height;
+}
+
+// 5. getNumberOfTreeNodes - count nodes whose key is still present
+int ConcurrentBinarySearchTree::getNumberOfTreeNodes() const {
+    int count = 0;
+    std::vector<const ConcurrentNode*> pending;
+    if (const ConcurrentNode* root = head.left.load(std::memory_order_acquire))
+        pending.push_back(root);
+    while (!pending.empty()) {
+        const ConcurrentNode* node = pending.back();
+        pending.pop_back();
+        if (!node->deleted.load(std::memory_order_relaxed))
+            ++count;
+        if (const ConcurrentNode* l = node->left.load(std::memory_order_acquire)) pending.push_back(l);
+        if (const ConcurrentNode* r = node->right.load(std::memory_order_acquire)) pending.push_back(r);
+    }
+    return count;
+}
+
+// 6. isEmpty - routing nodes alone do not count as keys
+bool ConcurrentBinarySearchTree::isEmpty() const {
+    return getNumberOfTreeNodes() == 0;
+}
+
+// 7. clear - free the linked nodes; retired ones belong to the EpochDomain
+void ConcurrentBinarySearchTree::clear() {
+    std::vector<ConcurrentNode*> pending;
+    if (ConcurrentNode* root = head.left.load(std::memory_order_relaxed))
+        pending.push_back(root);
+    while (!pending.empty()) {
+        ConcurrentNode* node = pending.back();
+        pending.pop_back();
+        if (ConcurrentNode* l = node->left.load(std::memory_order_relaxed)) pending.push_back(l);
+        if (ConcurrentNode* r = node->right.load(std::memory_order_relaxed)) pending.push_back(r);
+        delete node;
+    }
+    head.left.store(nullptr, std::memory_order_relaxed);
+}
+
+// 8. printInOrder - print the keys in an in-order traversal
+void ConcurrentBinarySearchTree::printInOrder() const {
+    std::cout << "Performing In-order traversal" << std::endl;
+    std::vector<const ConcurrentNode*> pending;
+    const ConcurrentNode* curr = head.left.load(std::memory_order_acquire);
+    while (curr || !pending.empty()) {
+        while (curr) {
+            pending.push_back(curr);
+            curr = curr->left.load(std::memory_order_acquire);
+        }
+        curr = pending.back();
+        pending.pop_back();
+        if (!curr->deleted.load(std::memory_order_relaxed))
+            std::cout << "Node key: " << curr->key << std::endl;
+        curr = curr->right.load(std::memory_order_acquire);
+    }
+}
+
+// 9. locate - optimistic lock coupling from the head sentinel down to key
+bool ConcurrentBinarySearchTree::locate(int key, Position& pos, bool unlinkRoutingNodes) const {
+    ConcurrentNode* parent = &head;
+    uint64_t parentVersion;
+    if (!readLock(parent, parentVersion))
+        return false;
+    ConcurrentNode* node = head.left.load(std::memory_order_acquire);
+
+    while (node) {
+        uint64_t nodeVersion;
+        if (!readLock(node, nodeVersion))
+            return false;
+        // The parent must not have changed since node was read from it
+        if (!validate(parent, parentVersion))
+            return false;
+        if (node->key == key) {
+            pos = {parent, parentVersion, node, nodeVersion};
+            return true;
+        }
+
+        ConcurrentNode* left = node->left.load(std::memory_order_acquire);
+        ConcurrentNode* right = node->right.load(std::memory_order_acquire);
+        if (unlinkRoutingNodes && (!left || !right) && node->deleted.load(std::memory_order_relaxed)) {
+            // A routing node that lost a child can go now; restart either way
+            tryUnlink(parent, parentVersion, node, nodeVersion);
+            return false;
+        }
+        if (!validate(node, nodeVersion))
+            return false;
+
+        parent = node;
+        parentVersion = nodeVersion;
+        node = key < node->key ? left : right;
+    }
+    pos = {parent, parentVersion, nullptr, 0};
+    return true;
+}
+
+// 10. tryUnlink - lock parent then node and splice node's only child into its place
+bool ConcurrentBinarySearchTree::tryUnlink(ConcurrentNode* parent, uint64_t parentVersion, ConcurrentNode* node, uint64_t nodeVersion) const {
+    if (!upgrade(parent, parentVersion))
+        return false;
+    if (!upgrade(node, nodeVersion)) {
+        writeUnlock(parent);
+        return false;
+    }
+    ConcurrentNode* left = node->left.load(std::memory_order_relaxed);
+    ConcurrentNode* right = node->right.load(std::memory_order_relaxed);
+    ConcurrentNode* child = left ? left : right;
+    if (parent == &head)
+        head.left.store(child, std::memory_order_release);
+    else if (parent->left.load(std::memory_order_relaxed) == node)
+        parent->left.store(child, std::memory_order_release);
+    else
+        parent->right.store(child, std::memory_order_release);
+    writeUnlockObsolete(node);
+    writeUnlock(parent);
+    retire(node);
+    return true;
+}
+
+// 11. retire - freed by the epoch domain once every guard that could see it has exited
+void ConcurrentBinarySearchTree::retire(ConcurrentNode* node) const {
+    EpochDomain::instance().retire(node, deleteNode);
+}
+
+// File-local: wait out a writer; false if the node has been unlinked
+static bool readLock(const ConcurrentNode* node, uint64_t& version) {
+    version = node->version.load(std::memory_order_acquire);
+    for (int spins = 0; version & LOCKED; ++spins) {
+        if (spins > 64)
+            std::this_thread::yield();
+        version = node->version.load(std::memory_order_acquire);
+    }
+    return !(version & OBSOLETE);
+}
+
+// File-local: true if nothing changed the node since version was read
+static bool validate(const ConcurrentNode* node, uint64_t version) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return node->version.load(std::memory_order_relaxed) == version;
+}
+
+// File-local: take the write lock only if the node is still at version
+static bool upgrade(ConcurrentNode* node, uint64_t version) {
+    if (!node->version.compare_exchange_strong(version, version + LOCKED, std::memory_order_acquire))
+        return false;
+    // Pairs with the reader's acquire fence in validate (seqlock ordering)
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+// File-local: release the lock and bump the change counter
+static void writeUnlock(ConcurrentNode* node) {
+    node->version.fetch_add(LOCKED, std::memory_order_release);
+}
+
+// File-local: release the lock and mark the node unlinked
+static void writeUnlockObsolete(ConcurrentNode* node) {
+    node->version.fetch_add(LOCKED + OBSOLETE, std::memory_order_release);
+}
+
+// File-local: deleter handed to the epoch domain
+static void deleteNode(void* node) {
+    delete static_cast<ConcurrentNode*>(node);
+}
@@ -0,0 +1,189 @@
+/**
+* @author - Hugh Hui
+* @file concurrent_bst.h -  This header file declares the methods in the concurrent_bst.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef CONCURRENTBST_H
+#define CONCURRENTBST_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @struct ConcurrentNode
+ * @brief A tree node guarded by an optimistic version lock.
+ *
+ * `version` packs two flag bits under a change counter: bit 1 is set while a
+ * writer holds the node, bit 0 marks a node that has been unlinked. Every
+ * change to the node's children or `deleted` flag happens under the lock and
+ * bumps the counter, so a reader can detect concurrent changes by comparing
+ * the version before and after it looks at the node.
+ */
+struct ConcurrentNode {
+    std::atomic<uint64_t> version;          /**< Lock bit, obsolete bit and change counter. */
+    const int key;                          /**< Key for the tree node. */
+    std::atomic<bool> deleted;              /**< Key was removed but the node still routes searches. */
+    std::atomic<ConcurrentNode*> left;      /**< Pointer to the left child. */
+    std::atomic<ConcurrentNode*> right;     /**< Pointer to the right child. */
+
+    /**
+     * @brief Constructor for ConcurrentNode.
+     *
+     * @param k The key of the node.
+     */
+    explicit ConcurrentNode(int k);
+};
+
+/**
+ * @class ConcurrentBinarySearchTree
+ * @brief A thread-safe binary search tree using optimistic lock coupling.
+ *
+ * `contains` takes no locks: it walks down reading node versions and restarts
+ * if a node it relied on changed underneath it. `addToTree` and `removeNode`
+ * walk the same way, then lock only the node (or parent and node) they
+ * change. Removing a key whose node has two children only marks the node as
+ * deleted, so no keys ever move between nodes; such routing nodes are
+ * unlinked later, once they are down to one child.
+ *
+ * `contains`, `addToTree` and `removeNode` run inside an EpochGuard, and
+ * unlinked nodes are handed to the process-wide EpochDomain, which frees
+ * them once no thread can still be reading them, so memory stays bounded
+ * under a steady stream of removes. `clear` and the destructor free the
+ * linked nodes and, like the statistics and print methods, must not run
+ * concurrently with other operations.
+ */
+class ConcurrentBinarySearchTree {
+public:
+    /**
+     * @brief Default constructor for ConcurrentBinarySearchTree.
+     *
+     * Initializes an empty tree.
+     */
+    ConcurrentBinarySearchTree();
+
+    /**
+     * @brief Destructor; frees the linked nodes.
+     *
+     * Nodes already retired are freed by the EpochDomain.
+     */
+    ~ConcurrentBinarySearchTree();
+
+    ConcurrentBinarySearchTree(const ConcurrentBinarySearchTree&) = delete;
+    ConcurrentBinarySearchTree& operator=(const ConcurrentBinarySearchTree&) = delete;
+
+    /**
+     * @brief Adds a key to the tree. Thread-safe.
+     *
+     * @param key The key to be added to the tree.
+     */
+    void addToTree(int key);
+
+    /**
+     * @brief Removes a key from the tree. Thread-safe.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the key was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Checks if the tree contains a key without taking any locks. Thread-safe.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key) const;
+
+    /**
+     * @brief Gets the height of the tree, counting routing nodes.
+     *
+     * Not safe to call concurrently with updates.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree() const;
+
+    /**
+     * @brief Gets the number of keys in the tree.
+     *
+     * Not safe to call concurrently with updates.
+     *
+     * @return The number of keys in the tree.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Checks if the tree holds no keys.
+     *
+     * Not safe to call concurrently with updates.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Clears the tree and frees its linked nodes.
+     *
+     * Not safe to call concurrently with any other operation.
+     */
+    void clear();
+
+    /**
+     * @brief Performs an in-order traversal of the tree and prints the keys.
+     *
+     * Not safe to call concurrently with updates.
+     */
+    void printInOrder() const;
+
+private:
+    /**
+     * @struct Position
+     * @brief Where a search for a key ended, with the versions it observed.
+     */
+    struct Position {
+        ConcurrentNode* parent;     /**< Last node above `node`, or the head sentinel. */
+        uint64_t parentVersion;     /**< Version of `parent` when its child was read. */
+        ConcurrentNode* node;       /**< Node holding the key, or nullptr if the walk fell off. */
+        uint64_t nodeVersion;       /**< Version of `node` when it was reached. */
+    };
+
+    mutable ConcurrentNode head;                /**< Sentinel; the tree hangs off head.left */
+
+    /**
+     * @brief Walks down to a key with optimistic lock coupling.
+     *
+     * Every hop reads a node's version, then re-validates its parent, so the
+     * walk only proceeds through nodes that were linked when they were read.
+     *
+     * @param key The key to search for.
+     * @param pos Receives where the walk ended.
+     * @param unlinkRoutingNodes If true, deleted nodes with at most one child
+     *        met along the way are unlinked (writers only).
+     * @return False if a concurrent change was detected and the walk must restart.
+     */
+    bool locate(int key, Position& pos, bool unlinkRoutingNodes) const;
+
+    /**
+     * @brief Unlinks a node with at most one child from its parent.
+     *
+     * Locks the parent, then the node, using the versions observed while
+     * walking down. Fails without side effects if either changed.
+     *
+     * @param parent The parent of the node.
+     * @param parentVersion The version read from the parent.
+     * @param node The node to unlink.
+     * @param nodeVersion The version read from the node.
+     * @return True if the node was unlinked and retired.
+     */
+    bool tryUnlink(ConcurrentNode* parent, uint64_t parentVersion, ConcurrentNode* node, uint64_t nodeVersion) const;
+
+    /**
+     * @brief Hands an unlinked node to the EpochDomain to be freed after its grace period.
+     *
+     * @param node The node to retire.
+     */
+    void retire(ConcurrentNode* node) const;
+};
+
+#endif // CONCURRENTBST_H
@@ -0,0 +1,110 @@
+/**
+* @author - Hugh Hui
+* @file convert_oplog.cpp - Converts a milestone4 JSON input file to the binary op-log format.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Usage: convert_oplog input.json output.oplog [--payload]
+*
+* By default the input is streamed and only opcodes and keys are kept, so any
+* size of file converts in constant memory. With --payload the input is loaded
+* whole and each action's other fields (fullName, address, ...) are stored as
+* its payload in compact JSON.
+*/
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "json.hpp"
+#include "action_stream.h"
+#include "op_log.h"
+
+using json = nlohmann::json;
+
+// Reads an action's "key" the way ActionSaxHandler does: only integers that fit an int count
+static bool readKey(const json& value, int& key) {
+    if (!value.is_object() || !value.contains("key"))
+        return false;
+    const json& field = value["key"];
+    if (field.is_number_unsigned()) {
+        if (field.get<json::number_unsigned_t>() > static_cast<json::number_unsigned_t>(INT_MAX))
+            return false;
+    }
+    else if (!field.is_number_integer()) {
+        return false;
+    }
+    long long number = field.get<long long>();
+    if (number < INT_MIN || number > INT_MAX)
+        return false;
+    key = static_cast<int>(number);
+    return true;
+}
+
+// Writes every action with its payload; needs the whole file in memory
+static bool convertWithPayloads(std::istream& in, OpLogWriter& writer) {
+    json testCases = json::parse(in, nullptr, false);
+    if (testCases.is_discarded() || !testCases.contains("cacheManager")) {
+        std::cerr << "Error parsing input file" << std::endl;
+        return false;
+    }
+    for (const auto& actionGroup : testCases["cacheManager"]) {
+        for (const auto& actionSet : actionGroup.items()) {
+            writer.beginTestCase(actionSet.key());
+            for (const auto& action : actionSet.value()) {
+                for (const auto& [name, value] : action.items()) {
+                    OpCode op;
+                    if (!opCodeForAction(name, op)) {
+                        std::cerr << "Skipping action without an opcode: " << name << std::endl;
+                        continue;
+                    }
+                    int key = 0;
+                    bool hasKey = readKey(value, key);
+                    if (!hasKey && (op == OP_ADD || op == OP_REMOVE || op == OP_CONTAINS)) {
+                        std::cerr << "Skipping action without a key: " << name << std::endl;
+                        continue;
+                    }
+                    json payload = value;
+                    if (payload.is_object()) payload.erase("key");
+                    std::string bytes = payload.empty() ? std::string() : payload.dump();
+                    writer.writeAction(op, key, bytes);
+                }
+            }
+            writer.endTestCase();
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || (argc == 4 && std::strcmp(argv[3], "--payload") != 0) || argc > 4) {
+        std::cerr << "Usage: convert_oplog input.json output.oplog [--payload]" << std::endl;
+        return 1;
+    }
+    bool keepPayloads = argc == 4;
+
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in) {
+        std::cerr << "Error opening input file: " << argv[1] << std::endl;
+        return 1;
+    }
+    std::ofstream out(argv[2], std::ios::binary);
+    if (!out) {
+        std::cerr << "Error opening output file: " << argv[2] << std::endl;
+        return 1;
+    }
+
+    OpLogWriter writer(out);
+    bool ok = keepPayloads ? convertWithPayloads(in, writer) : streamActions(in, writer);
+    out.flush();
+    if (!ok || !out) {
+        std::cerr << "Conversion failed" << std::endl;
+        return 1;
+    }
+
+    in.clear();
+    in.seekg(0, std::ios::end);
+    std::streamoff inputBytes = in.tellg();
+    std::cout << writer.getNumberOfActions() << " actions, "
+              << inputBytes << " bytes -> " << out.tellp() << " bytes" << std::endl;
+    return 0;
+}
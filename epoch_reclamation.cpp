@@ -0,0 +1,208 @@
+/**
+* @author - Hugh Hui
+* @file epoch_reclamation.cpp - Epoch-based memory reclamation for the lock-free tree.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "epoch_reclamation.h"
+
+// Retires between attempts to advance the epoch
+static const int ADVANCE_INTERVAL = 64;
+
+/**
+ * @struct EpochDomain::ThreadRecord
+ * @brief Per-thread announcement and limbo lists.
+ */
+struct EpochDomain::ThreadRecord {
+    std::atomic<uint64_t> localEpoch{0};    /**< Epoch announced while active. */
+    std::atomic<bool> active{false};        /**< Inside a guard. */
+    std::atomic<bool> inUse{false};         /**< Claimed by a live thread. */
+    ThreadRecord* next = nullptr;           /**< Link in the domain's record list. */
+    int nesting = 0;                        /**< Guard nesting depth (owner only). */
+    int retiresSinceAdvance = 0;            /**< Owner only. */
+    std::vector<Retired> limbo[3];          /**< Retired objects by epoch modulo 3 (owner only). */
+};
+
+/**
+ * @struct ThreadRecordOwner
+ * @brief Releases the thread's record when the thread exits.
+ */
+struct ThreadRecordOwner {
+    EpochDomain::ThreadRecord* record = nullptr;
+    ~ThreadRecordOwner() {
+        if (record)
+            EpochDomain::instance().releaseRecord(record);
+    }
+};
+
+static thread_local ThreadRecordOwner localOwner;
+
+// Constructor: epoch starts at 2 so "epoch + 2 <= current" never underflows
+EpochDomain::EpochDomain()
+    : globalEpoch(2), records(nullptr), pending(0) {}
+
+// Destructor: runs after every thread_local owner, so all limbo is orphaned by now
+EpochDomain::~EpochDomain() {
+    for (Retired& entry : orphans)
+        entry.deleter(entry.object);
+    orphans.clear();
+    ThreadRecord* record = records.exchange(nullptr);
+    while (record) {
+        ThreadRecord* next = record->next;
+        for (std::vector<Retired>& bag : record->limbo)
+            for (Retired& entry : bag)
+                entry.deleter(entry.object);
+        delete record;
+        record = next;
+    }
+}
+
+// 1. instance - the process-wide domain
+EpochDomain& EpochDomain::instance() {
+    static EpochDomain domain;
+    return domain;
+}
+
+// 2. enter - announce the current epoch; the announcement must be visible before any shared read
+void EpochDomain::enter() {
+    ThreadRecord* record = localRecord();
+    if (record->nesting++ > 0)
+        return;
+    uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+    while (true) {
+        record->localEpoch.store(epoch, std::memory_order_seq_cst);
+        record->active.store(true, std::memory_order_seq_cst);
+        uint64_t current = globalEpoch.load(std::memory_order_seq_cst);
+        if (current == epoch)
+            break;
+        epoch = current;
+    }
+    reclaim(record, epoch);
+}
+
+// 3. exit - leave the critical section
+void EpochDomain::exit() {
+    ThreadRecord* record = localOwner.record;
+    if (--record->nesting > 0)
+        return;
+    record->active.store(false, std::memory_order_release);
+}
+
+// 4. retire - stamp with the epoch seen after the unlink and park in limbo
+void EpochDomain::retire(void* object, void (*deleter)(void*)) {
+    ThreadRecord* record = localRecord();
+    uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+    std::vector<Retired>& bag = record->limbo[epoch % 3];
+    // A bag from an older epoch sharing this slot is at least 3 epochs old
+    if (!bag.empty() && bag.front().epoch != epoch) {
+        for (Retired& entry : bag)
+            entry.deleter(entry.object);
+        pending.fetch_sub(static_cast<long long>(bag.size()), std::memory_order_relaxed);
+        bag.clear();
+    }
+    bag.push_back({object, deleter, epoch});
+    pending.fetch_add(1, std::memory_order_relaxed);
+
+    if (++record->retiresSinceAdvance >= ADVANCE_INTERVAL) {
+        record->retiresSinceAdvance = 0;
+        uint64_t current = tryAdvance();
+        reclaim(record, current);
+        reclaimOrphans(current);
+    }
+}
+
+// 5. collect - advance as far as the active threads allow and free what is safe
+void EpochDomain::collect() {
+    ThreadRecord* record = localRecord();
+    uint64_t epoch = globalEpoch.load(std::memory_order_acquire);
+    for (int attempt = 0; attempt < 3; ++attempt)
+        epoch = tryAdvance();
+    reclaim(record, epoch);
+    reclaimOrphans(epoch);
+}
+
+// 6. pendingCount - retired but not yet freed
+long long EpochDomain::pendingCount() const {
+    return pending.load(std::memory_order_relaxed);
+}
+
+// 7. localRecord - claim a free record or append a new one
+EpochDomain::ThreadRecord* EpochDomain::localRecord() {
+    if (localOwner.record)
+        return localOwner.record;
+
+    for (ThreadRecord* record = records.load(std::memory_order_acquire); record; record = record->next) {
+        bool expected = false;
+        if (!record->inUse.load(std::memory_order_relaxed) &&
+            record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            localOwner.record = record;
+            return record;
+        }
+    }
+
+    ThreadRecord* record = new ThreadRecord();
+    record->inUse.store(true, std::memory_order_relaxed);
+    ThreadRecord* head = records.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+    localOwner.record = record;
+    return record;
+}
+
+// 8. tryAdvance - move to the next epoch if nobody active lags behind
+uint64_t EpochDomain::tryAdvance() {
+    uint64_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+    for (ThreadRecord* record = records.load(std::memory_order_acquire); record; record = record->next) {
+        if (record->active.load(std::memory_order_seq_cst) &&
+            record->localEpoch.load(std::memory_order_seq_cst) != epoch)
+            return epoch;
+    }
+    if (globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst))
+        return epoch + 1;
+    return epoch; // someone else advanced; epoch now holds the newer value
+}
+
+// 9. reclaim - free this thread's bags that are two epochs behind
+void EpochDomain::reclaim(ThreadRecord* record, uint64_t epoch) {
+    for (std::vector<Retired>& bag : record->limbo) {
+        if (!bag.empty() && bag.front().epoch + 2 <= epoch) {
+            for (Retired& entry : bag)
+                entry.deleter(entry.object);
+            pending.fetch_sub(static_cast<long long>(bag.size()), std::memory_order_relaxed);
+            bag.clear();
+        }
+    }
+}
+
+// 10. reclaimOrphans - free adopted entries that are two epochs behind
+void EpochDomain::reclaimOrphans(uint64_t epoch) {
+    // Never wait here: orphans are rare and the next caller will get them
+    std::unique_lock<std::mutex> guard(orphanMutex, std::try_to_lock);
+    if (!guard.owns_lock())
+        return;
+    size_t kept = 0;
+    for (size_t i = 0; i < orphans.size(); ++i) {
+        if (orphans[i].epoch + 2 <= epoch) {
+            orphans[i].deleter(orphans[i].object);
+            pending.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+            orphans[kept++] = orphans[i];
+        }
+    }
+    orphans.resize(kept);
+}
+
+// 11. releaseRecord - a thread is exiting: orphan its limbo and free the slot
+void EpochDomain::releaseRecord(ThreadRecord* record) {
+    {
+        std::lock_guard<std::mutex> guard(orphanMutex);
+        for (std::vector<Retired>& bag : record->limbo) {
+            orphans.insert(orphans.end(), bag.begin(), bag.end());
+            bag.clear();
+        }
+    }
+    record->nesting = 0;
+    record->retiresSinceAdvance = 0;
+    record->active.store(false, std::memory_order_release);
+    record->inUse.store(false, std::memory_order_release);
+}
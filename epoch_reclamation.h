@@ -0,0 +1,155 @@
+/**
+* @author - Hugh Hui
+* @file epoch_reclamation.h -  This header file declares the methods in the epoch_reclamation.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef EPOCHRECLAMATION_H
+#define EPOCHRECLAMATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class EpochDomain
+ * @brief Process-wide epoch-based memory reclamation for lock-free structures.
+ *
+ * Threads wrap every access to shared nodes in an EpochGuard, which announces
+ * the global epoch the thread is running in. A node that has been unlinked is
+ * handed to `retire` instead of being deleted. The global epoch only advances
+ * once every thread inside a guard has announced the current epoch, so a node
+ * retired in epoch e is freed once the epoch reaches e + 2: by then no thread
+ * that could have seen the node is still inside its guard.
+ *
+ * Each thread keeps three limbo lists (one per epoch modulo 3) so retiring
+ * and freeing never take a lock. Lists left behind by exiting threads are
+ * adopted into a shared orphan list and freed by whichever thread next
+ * advances the epoch.
+ */
+class EpochDomain {
+public:
+    /**
+     * @brief Gets the process-wide domain.
+     *
+     * @return Reference to the domain.
+     */
+    static EpochDomain& instance();
+
+    /**
+     * @brief Enters a critical section; nests.
+     */
+    void enter();
+
+    /**
+     * @brief Leaves a critical section.
+     */
+    void exit();
+
+    /**
+     * @brief Schedules an unlinked object to be freed once no reader can hold it.
+     *
+     * Must be called after the object became unreachable from the structure.
+     *
+     * @param object The object to free.
+     * @param deleter Function that frees the object.
+     */
+    void retire(void* object, void (*deleter)(void*));
+
+    /**
+     * @brief Tries to advance the epoch and frees everything that became safe.
+     *
+     * Useful at quiescent points such as the end of a test; calling it
+     * inside a guard is allowed but frees less.
+     */
+    void collect();
+
+    /**
+     * @brief Gets the number of retired objects not freed yet.
+     *
+     * @return The count over all threads and orphans.
+     */
+    long long pendingCount() const;
+
+    /**
+     * @brief Frees every orphaned object at process exit.
+     */
+    ~EpochDomain();
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    struct ThreadRecord;
+
+private:
+    /**
+     * @struct Retired
+     * @brief An object waiting for its grace period.
+     */
+    struct Retired {
+        void* object;               /**< Object to free. */
+        void (*deleter)(void*);     /**< Function that frees it. */
+        uint64_t epoch;             /**< Global epoch at the time it was retired. */
+    };
+
+    std::atomic<uint64_t> globalEpoch;          /**< Current epoch. */
+    std::atomic<ThreadRecord*> records;         /**< Lock-free list of all thread records. */
+    std::atomic<long long> pending;             /**< Retired objects not freed yet. */
+    std::mutex orphanMutex;                     /**< Guards `orphans`. */
+    std::vector<Retired> orphans;               /**< Objects left by exited threads. */
+
+    EpochDomain();
+
+    /**
+     * @brief Gets or claims the calling thread's record.
+     *
+     * @return The calling thread's record.
+     */
+    ThreadRecord* localRecord();
+
+    /**
+     * @brief Advances the global epoch if every active thread has caught up.
+     *
+     * @return The epoch after the attempt.
+     */
+    uint64_t tryAdvance();
+
+    /**
+     * @brief Frees the calling thread's limbo entries that are at least two epochs old.
+     *
+     * @param record The calling thread's record.
+     * @param epoch The current global epoch.
+     */
+    void reclaim(ThreadRecord* record, uint64_t epoch);
+
+    /**
+     * @brief Frees orphaned entries that are at least two epochs old.
+     *
+     * @param epoch The current global epoch.
+     */
+    void reclaimOrphans(uint64_t epoch);
+
+    /**
+     * @brief Hands a record's limbo lists to the orphan list and releases the record.
+     *
+     * @param record The record of an exiting thread.
+     */
+    void releaseRecord(ThreadRecord* record);
+
+    friend struct ThreadRecordOwner;
+};
+
+/**
+ * @class EpochGuard
+ * @brief RAII critical section of the process-wide EpochDomain.
+ */
+class EpochGuard {
+public:
+    EpochGuard() { EpochDomain::instance().enter(); }
+    ~EpochGuard() { EpochDomain::instance().exit(); }
+    EpochGuard(const EpochGuard&) = delete;
+    EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+#endif // EPOCHRECLAMATION_H
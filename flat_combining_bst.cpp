@@ -0,0 +1,156 @@
+/**
+* @author - Hugh Hui
+* @file flat_combining_bst.cpp - Flat-combining front end that batches operations on a BinarySearchTree.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "flat_combining_bst.h"
+#include <algorithm>
+#include <thread>
+
+// Spins on the own slot before yielding the core
+static const int SPINS_BEFORE_YIELD = 256;
+
+// Each thread starts its slot search at its own index, so slots are rarely shared
+static std::atomic<int> nextSlotHint(0);
+static thread_local int slotHint = nextSlotHint.fetch_add(1, std::memory_order_relaxed);
+
+// Constructor: initialize empty tree
+FlatCombiningBinarySearchTree::FlatCombiningBinarySearchTree()
+    : combining(false) {}
+
+// Destructor: the tree frees itself
+FlatCombiningBinarySearchTree::~FlatCombiningBinarySearchTree() {}
+
+// 1. addToTree - post an insert
+void FlatCombiningBinarySearchTree::addToTree(int key) {
+    execute(ADD, key);
+}
+
+// 2. removeNode - post a remove
+bool FlatCombiningBinarySearchTree::removeNode(int key) {
+    return execute(REMOVE, key);
+}
+
+// 3. contains - post a lookup
+bool FlatCombiningBinarySearchTree::contains(int key) {
+    return execute(CONTAINS, key);
+}
+
+// 4. getHeightOfTree - Get the height of the tree
+int FlatCombiningBinarySearchTree::getHeightOfTree() {
+    lockCombiner();
+    int height = tree.getHeightOfTree();
+    unlockCombiner();
+    return height;
+}
+
+// 5. getNumberOfTreeNodes - Get the total number of nodes in the tree
+int FlatCombiningBinarySearchTree::getNumberOfTreeNodes() {
+    lockCombiner();
+    int count = tree.getNumberOfTreeNodes();
+    unlockCombiner();
+    return count;
+}
+
+// 6. isEmpty - Check if the tree is empty
+bool FlatCombiningBinarySearchTree::isEmpty() {
+    lockCombiner();
+    bool empty = tree.isEmpty();
+    unlockCombiner();
+    return empty;
+}
+
+// 7. clear - Removes tree
+void FlatCombiningBinarySearchTree::clear() {
+    lockCombiner();
+    tree.clear();
+    unlockCombiner();
+}
+
+// 8. printInOrder - print the tree in an in-order traversal
+void FlatCombiningBinarySearchTree::printInOrder() {
+    lockCombiner();
+    tree.printInOrder();
+    unlockCombiner();
+}
+
+// 9. execute - publish, then either wait for a combiner or become one
+bool FlatCombiningBinarySearchTree::execute(Operation operation, int key) {
+    Slot* slot = nullptr;
+    for (int i = 0; !slot; ++i) {
+        Slot& candidate = slots[(slotHint + i) % NUMBER_OF_SLOTS];
+        int expected = FREE;
+        if (candidate.state.load(std::memory_order_relaxed) == FREE &&
+            candidate.state.compare_exchange_strong(expected, CLAIMED, std::memory_order_acquire))
+            slot = &candidate;
+        else if (i > 0 && i % NUMBER_OF_SLOTS == 0)
+            std::this_thread::yield(); // more threads than slots
+    }
+    slot->operation = operation;
+    slot->key = key;
+    slot->state.store(PENDING, std::memory_order_release);
+
+    for (int spins = 0; slot->state.load(std::memory_order_acquire) != DONE; ++spins) {
+        if (tryLockCombiner()) {
+            combine();
+            unlockCombiner();
+        } else if (spins > SPINS_BEFORE_YIELD) {
+            std::this_thread::yield();
+        }
+    }
+    bool result = slot->result;
+    slot->state.store(FREE, std::memory_order_release);
+    return result;
+}
+
+// 10. combine - sort the pending slots by key, insert in one pass, then remove and look up in order
+void FlatCombiningBinarySearchTree::combine() {
+    batch.clear();
+    for (Slot& slot : slots)
+        if (slot.state.load(std::memory_order_acquire) == PENDING)
+            batch.push_back(&slot);
+    if (batch.empty())
+        return;
+    std::sort(batch.begin(), batch.end(), [](const Slot* a, const Slot* b) {
+        return a->key != b->key ? a->key < b->key : a->operation < b->operation;
+    });
+
+    addKeys.clear();
+    for (Slot* slot : batch) {
+        if (slot->operation == ADD && (addKeys.empty() || addKeys.back() != slot->key))
+            addKeys.push_back(slot->key);
+    }
+    if (!addKeys.empty())
+        tree.addSortedKeys(addKeys);
+
+    for (Slot* slot : batch) {
+        if (slot->operation == CONTAINS)
+            slot->result = tree.contains(slot->key);
+        else if (slot->operation == REMOVE)
+            slot->result = tree.removeNode(slot->key);
+        else
+            slot->result = false;
+    }
+    for (Slot* slot : batch)
+        slot->state.store(DONE, std::memory_order_release);
+}
+
+// 11. tryLockCombiner - test before the exchange so waiters do not bounce the line
+bool FlatCombiningBinarySearchTree::tryLockCombiner() {
+    return !combining.load(std::memory_order_relaxed) &&
+           !combining.exchange(true, std::memory_order_acquire);
+}
+
+// 12. lockCombiner - spin until the lock is ours, applying pending work first
+void FlatCombiningBinarySearchTree::lockCombiner() {
+    for (int spins = 0; !tryLockCombiner(); ++spins) {
+        if (spins > SPINS_BEFORE_YIELD)
+            std::this_thread::yield();
+    }
+    combine();
+}
+
+// 13. unlockCombiner - release the combiner lock
+void FlatCombiningBinarySearchTree::unlockCombiner() {
+    combining.store(false, std::memory_order_release);
+}
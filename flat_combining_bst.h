@@ -0,0 +1,163 @@
+/**
+* @author - Hugh Hui
+* @file flat_combining_bst.h -  This header file declares the methods in the flat_combining_bst.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef FLATCOMBININGBST_H
+#define FLATCOMBININGBST_H
+
+#include <atomic>
+#include <vector>
+#include "binary_search_tree.h"
+
+/**
+ * @class FlatCombiningBinarySearchTree
+ * @brief A thread-safe BinarySearchTree front end that batches operations by flat combining.
+ *
+ * A caller posts its operation in a publication slot and spins on that slot
+ * only. Whichever caller gets the combiner lock collects every pending slot,
+ * sorts the batch by key and applies it. All inserts in the batch go down the
+ * tree together in one `addSortedKeys` pass, and the removes and lookups
+ * follow in key order. Every operation in a batch is pending for the whole
+ * time the batch runs, so any order within the batch is linearizable.
+ *
+ * Under contention the lock changes hands once per batch instead of once per
+ * operation, and the tree's cache lines stay on the combining core.
+ */
+class FlatCombiningBinarySearchTree {
+public:
+    /**
+     * @brief Default constructor for FlatCombiningBinarySearchTree.
+     *
+     * Initializes an empty tree.
+     */
+    FlatCombiningBinarySearchTree();
+
+    /**
+     * @brief Destructor; must not race with other operations.
+     */
+    ~FlatCombiningBinarySearchTree();
+
+    FlatCombiningBinarySearchTree(const FlatCombiningBinarySearchTree&) = delete;
+    FlatCombiningBinarySearchTree& operator=(const FlatCombiningBinarySearchTree&) = delete;
+
+    /**
+     * @brief Adds a key to the tree, possibly as part of another thread's batch.
+     *
+     * @param key The key to be added to the tree.
+     */
+    void addToTree(int key);
+
+    /**
+     * @brief Removes a key from the tree, possibly as part of another thread's batch.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the node was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Checks if the tree contains a key, possibly as part of another thread's batch.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key);
+
+    /**
+     * @brief Gets the height of the tree. Takes the combiner lock.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree();
+
+    /**
+     * @brief Gets the number of nodes in the tree. Takes the combiner lock.
+     *
+     * @return The number of nodes in the tree.
+     */
+    int getNumberOfTreeNodes();
+
+    /**
+     * @brief Checks if the tree is empty. Takes the combiner lock.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty();
+
+    /**
+     * @brief Clears the entire tree. Takes the combiner lock.
+     */
+    void clear();
+
+    /**
+     * @brief Performs an in-order traversal of the tree and prints the nodes. Takes the combiner lock.
+     */
+    void printInOrder();
+
+private:
+    /**
+     * @enum Operation
+     * @brief Operation codes posted in a slot.
+     */
+    enum Operation { ADD, CONTAINS, REMOVE };
+
+    /**
+     * @enum SlotState
+     * @brief Life cycle of a publication slot.
+     */
+    enum SlotState { FREE, CLAIMED, PENDING, DONE };
+
+    /**
+     * @struct Slot
+     * @brief One posted operation, on its own cache line.
+     */
+    struct alignas(64) Slot {
+        std::atomic<int> state{FREE};   /**< SlotState; PENDING and DONE hand the slot over */
+        Operation operation = ADD;      /**< Written by the poster before PENDING */
+        int key = 0;                    /**< Written by the poster before PENDING */
+        bool result = false;            /**< Written by the combiner before DONE */
+    };
+
+    static const int NUMBER_OF_SLOTS = 64;  /**< Threads beyond this wait for a free slot */
+
+    Slot slots[NUMBER_OF_SLOTS];        /**< Publication slots */
+    std::atomic<bool> combining;        /**< Combiner lock; also guards the members below */
+    BinarySearchTree tree;              /**< The underlying tree */
+    std::vector<Slot*> batch;           /**< Scratch list of pending slots */
+    std::vector<int> addKeys;           /**< Scratch list of keys to insert */
+
+    /**
+     * @brief Posts an operation and waits until some combiner has applied it.
+     *
+     * @param operation The operation to run.
+     * @param key The key it applies to.
+     * @return The operation's result (false for ADD).
+     */
+    bool execute(Operation operation, int key);
+
+    /**
+     * @brief Applies every pending slot as one sorted batch; combiner lock held.
+     */
+    void combine();
+
+    /**
+     * @brief Tries to take the combiner lock without waiting.
+     *
+     * @return True if the lock was taken.
+     */
+    bool tryLockCombiner();
+
+    /**
+     * @brief Takes the combiner lock, combining any pending batch first.
+     */
+    void lockCombiner();
+
+    /**
+     * @brief Releases the combiner lock.
+     */
+    void unlockCombiner();
+};
+
+#endif // FLATCOMBININGBST_H
@@ -0,0 +1,97 @@
+/**
+* @author - Hugh Hui
+* @file latency_histogram.cpp - Log-linear latency histograms and the tick clock they are fed from.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "latency_histogram.h"
+#include <cmath>
+#include <thread>
+
+// File-local helpers
+static double measureTicksPerNs();
+
+// 1. toNs - ticks times the measured rate
+double LatencyClock::toNs(uint64_t ticks) {
+    static const double ticksPerNs = measureTicksPerNs();
+    return static_cast<double>(ticks) / ticksPerNs;
+}
+
+// 2. merge - add the other histogram bucket by bucket
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.count == 0) {
+        return;
+    }
+    if (counts.empty()) {
+        counts.resize(BUCKET_COUNT);
+    }
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts[i] += other.counts[i];
+    }
+    count += other.count;
+    if (other.max > max) {
+        max = other.max;
+    }
+}
+
+// 3. clear - zero the buckets but keep them for the next test case
+void LatencyHistogram::clear() {
+    for (uint64_t& bucket : counts) {
+        bucket = 0;
+    }
+    count = 0;
+    max = 0;
+}
+
+// 4. valueAtPercentile - walk the buckets until enough values are covered
+uint64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count)));
+    if (rank < 1) {
+        rank = 1;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            uint64_t upper = bucketUpperBound(i);
+            return upper < max ? upper : max;
+        }
+    }
+    return max;
+}
+
+// 5. bucketUpperBound - inverse of bucketIndex
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return index;
+    }
+    int shift = static_cast<int>(index / SUB_BUCKET_COUNT) - 1;
+    uint64_t top = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+    return ((top + 1) << shift) - 1;
+}
+
+// 6. writeLatencySummary - one line per histogram
+void writeLatencySummary(std::ostream& out, std::string_view label, const LatencyHistogram& histogram) {
+    out << "latency " << label << ": count " << histogram.getCount()
+        << ", p50 " << std::llround(LatencyClock::toNs(histogram.valueAtPercentile(50.0))) << " ns"
+        << ", p90 " << std::llround(LatencyClock::toNs(histogram.valueAtPercentile(90.0))) << " ns"
+        << ", p99 " << std::llround(LatencyClock::toNs(histogram.valueAtPercentile(99.0))) << " ns"
+        << ", p99.9 " << std::llround(LatencyClock::toNs(histogram.valueAtPercentile(99.9))) << " ns"
+        << ", max " << std::llround(LatencyClock::toNs(histogram.getMax())) << " ns" << std::endl;
+}
+
+// File-local: ticks per nanosecond, from a 10 ms sleep timed by both clocks
+static double measureTicksPerNs() {
+#if defined(__x86_64__) || defined(__i386__)
+    auto wallStart = std::chrono::steady_clock::now();
+    uint64_t tickStart = LatencyClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    uint64_t ticks = LatencyClock::now() - tickStart;
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - wallStart).count();
+    return ns > 0.0 && ticks > 0 ? static_cast<double>(ticks) / ns : 1.0;
+#else
+    return 1.0;
+#endif
+}
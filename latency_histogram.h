@@ -0,0 +1,168 @@
+/**
+* @author - Hugh Hui
+* @file latency_histogram.h -  This header file declares the methods in the latency_histogram.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * @class LatencyClock
+ * @brief A cheap tick counter for timing single operations.
+ *
+ * On x86 a tick is one time stamp counter cycle read with `rdtsc`, which
+ * costs a few nanoseconds and needs no system call. The counter is assumed
+ * to be invariant (constant rate across cores and power states), as on any
+ * x86 CPU of the last decade. Elsewhere a tick is one steady_clock
+ * nanosecond.
+ */
+class LatencyClock {
+public:
+    /**
+     * @brief Reads the tick counter.
+     *
+     * @return The current tick count; only differences are meaningful.
+     */
+    static uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief Converts ticks to nanoseconds.
+     *
+     * The tick rate is measured against steady_clock on the first call, which
+     * takes about 10 ms; call it after the timed work.
+     *
+     * @param ticks A difference of two `now` readings.
+     * @return The same duration in nanoseconds.
+     */
+    static double toNs(uint64_t ticks);
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief Counts durations in log-linear buckets, HdrHistogram style.
+ *
+ * Values below 64 ticks get a bucket each. Above that, every power of two is
+ * split into 32 equal buckets, so any recorded value is known to within about
+ * 3% and recording is a shift and an increment. Values of 2^40 ticks or more
+ * share the last bucket; the exact maximum is kept separately.
+ *
+ * Buckets are allocated on the first `record`, so an unused histogram costs
+ * only its members.
+ */
+class LatencyHistogram {
+public:
+    /**
+     * @brief Adds one duration.
+     *
+     * @param ticks The duration in LatencyClock ticks.
+     */
+    void record(uint64_t ticks) {
+        if (counts.empty()) {
+            counts.resize(BUCKET_COUNT);
+        }
+        ++counts[bucketIndex(ticks)];
+        ++count;
+        if (ticks > max) {
+            max = ticks;
+        }
+    }
+
+    /**
+     * @brief Adds every duration of another histogram to this one.
+     *
+     * @param other The histogram to add.
+     */
+    void merge(const LatencyHistogram& other);
+
+    /**
+     * @brief Forgets every duration; the buckets stay allocated.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of recorded durations.
+     *
+     * @return The count.
+     */
+    uint64_t getCount() const { return count; }
+
+    /**
+     * @brief Gets the largest recorded duration.
+     *
+     * @return The exact maximum in ticks, 0 if empty.
+     */
+    uint64_t getMax() const { return max; }
+
+    /**
+     * @brief Gets the duration at or below which a share of the values fall.
+     *
+     * @param percentile 0 to 100, e.g. 99.9.
+     * @return The upper edge of the bucket holding that value, in ticks, never above the maximum; 0 if empty.
+     */
+    uint64_t valueAtPercentile(double percentile) const;
+
+private:
+    static const int SUB_BUCKET_BITS = 5;                            /**< 32 buckets per power of two */
+    static const uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+    static const int MAX_MAGNITUDE = 40;                             /**< Values are clamped below 2^40 ticks */
+    static const size_t BUCKET_COUNT = (MAX_MAGNITUDE - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    std::vector<uint64_t> counts;  /**< Durations per bucket, empty until the first record */
+    uint64_t count = 0;            /**< Number of recorded durations */
+    uint64_t max = 0;              /**< Largest recorded duration */
+
+    /**
+     * @brief Finds the bucket for a duration.
+     *
+     * @param ticks The duration.
+     * @return Its bucket index.
+     */
+    static size_t bucketIndex(uint64_t ticks) {
+        if (ticks >= (1ull << MAX_MAGNITUDE)) {
+            ticks = (1ull << MAX_MAGNITUDE) - 1;
+        }
+        if (ticks < 2 * SUB_BUCKET_COUNT) {
+            return static_cast<size_t>(ticks);
+        }
+        int shift = 63 - __builtin_clzll(ticks) - SUB_BUCKET_BITS;
+        return static_cast<size_t>((shift + 1) * SUB_BUCKET_COUNT + (ticks >> shift) - SUB_BUCKET_COUNT);
+    }
+
+    /**
+     * @brief Gets the largest duration that falls in a bucket.
+     *
+     * @param index The bucket index.
+     * @return Its upper edge in ticks.
+     */
+    static uint64_t bucketUpperBound(size_t index);
+};
+
+/**
+ * @brief Writes a histogram's percentiles as one line, e.g. for the driver's errorLogFile.
+ *
+ * Format: "latency <label>: count N, p50 X ns, p90 X ns, p99 X ns, p99.9 X ns, max X ns".
+ *
+ * @param out The stream to write to.
+ * @param label What was measured, e.g. a test case and action name.
+ * @param histogram The histogram to write.
+ */
+void writeLatencySummary(std::ostream& out, std::string_view label, const LatencyHistogram& histogram);
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,279 @@
+/**
+* @author - Hugh Hui
+* @file lockfree_bst.cpp - Lock-free external binary search tree with epoch-based reclamation.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "lockfree_bst.h"
+#include "epoch_reclamation.h"
+#include <climits>
+#include <iostream>
+#include <vector>
+
+// Edge bits in the low bits of a child word
+static const uintptr_t TAG = 1;
+static const uintptr_t FLAG = 2;
+static const uintptr_t EDGE_BITS = TAG | FLAG;
+
+// Sentinel keys, all larger than any int key
+static const long long INF0 = static_cast<long long>(INT_MAX) + 1;
+static const long long INF1 = static_cast<long long>(INT_MAX) + 2;
+static const long long INF2 = static_cast<long long>(INT_MAX) + 3;
+
+// File-local helpers
+static LockFreeNode* address(uintptr_t word);
+static std::atomic<uintptr_t>& childToward(LockFreeNode* node, long long key);
+static void deleteNode(void* node);
+static void deleteSubtree(LockFreeNode* node);
+
+// LockFreeNode constructor
+LockFreeNode::LockFreeNode(long long k, uintptr_t l, uintptr_t r)
+    : key(k), left(l), right(r) {}
+
+// Constructor: R(inf2) -> { S(inf1) -> { leaf(inf0), leaf(inf1) }, leaf(inf2) }
+LockFreeBinarySearchTree::LockFreeBinarySearchTree() {
+    LockFreeNode* s = new LockFreeNode(INF1,
+                                       reinterpret_cast<uintptr_t>(new LockFreeNode(INF0)),
+                                       reinterpret_cast<uintptr_t>(new LockFreeNode(INF1)));
+    root = new LockFreeNode(INF2,
+                            reinterpret_cast<uintptr_t>(s),
+                            reinterpret_cast<uintptr_t>(new LockFreeNode(INF2)));
+}
+
+// Destructor: delete entire tree
+LockFreeBinarySearchTree::~LockFreeBinarySearchTree() {
+    deleteSubtree(root);
+}
+
+// 1. addToTree - replace the leaf with a new internal node over the old and new leaves
+bool LockFreeBinarySearchTree::addToTree(int key) {
+    EpochGuard guard;
+    SeekRecord record;
+    while (true) {
+        seek(key, record);
+        LockFreeNode* leaf = record.leaf;
+        if (leaf->key == key)
+            return false; // no duplicates
+
+        LockFreeNode* fresh = new LockFreeNode(key);
+        LockFreeNode* internal = key < leaf->key
+            ? new LockFreeNode(leaf->key, reinterpret_cast<uintptr_t>(fresh), reinterpret_cast<uintptr_t>(leaf))
+            : new LockFreeNode(key, reinterpret_cast<uintptr_t>(leaf), reinterpret_cast<uintptr_t>(fresh));
+
+        std::atomic<uintptr_t>& childEdge = childToward(record.parent, key);
+        uintptr_t expected = reinterpret_cast<uintptr_t>(leaf);
+        if (childEdge.compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(internal), std::memory_order_acq_rel))
+            return true;
+
+        // Never published, so no grace period needed
+        delete internal;
+        delete fresh;
+        // The edge is being removed under us: help finish it, then retry
+        if (address(expected) == leaf && (expected & EDGE_BITS))
+            cleanup(key, record);
+    }
+}
+
+// 2. removeNode - flag the edge to the leaf (injection), then splice it out (cleanup)
+bool LockFreeBinarySearchTree::removeNode(int key) {
+    EpochGuard guard;
+    SeekRecord record;
+    bool injecting = true;
+    LockFreeNode* leaf = nullptr;
+    while (true) {
+        seek(key, record);
+        std::atomic<uintptr_t>& childEdge = childToward(record.parent, key);
+
+        if (injecting) {
+            leaf = record.leaf;
+            if (leaf->key != key)
+                return false;
+            uintptr_t expected = reinterpret_cast<uintptr_t>(leaf);
+            if (childEdge.compare_exchange_strong(expected, expected | FLAG, std::memory_order_acq_rel)) {
+                // The flag is the linearization point: the key is ours to remove
+                injecting = false;
+                if (cleanup(key, record))
+                    return true;
+            } else if (address(expected) == leaf && (expected & EDGE_BITS)) {
+                cleanup(key, record);
+            }
+        } else {
+            // Our guard keeps leaf alive, so comparing addresses is safe
+            if (record.leaf != leaf)
+                return true; // a helper finished the splice
+            if (cleanup(key, record))
+                return true;
+        }
+    }
+}
+
+// 3. contains - read-only walk to a leaf
+bool LockFreeBinarySearchTree::contains(int key) const {
+    EpochGuard guard;
+    SeekRecord record;
+    seek(key, record);
+    return record.leaf->key == key;
+}
+
+// 4. getHeightOfTree - level-by-level count
+int LockFreeBinarySearchTree::getHeightOfTree() const {
+    int height = 0;
+    std::vector<const LockFreeNode*> level(1, root);
+    std::vector<const LockFreeNode*> nextLevel;
+    while (!level.empty()) {
+        ++height;
+        nextLevel.clear();
+        for (const LockFreeNode* node : level) {
+            if (LockFreeNode* l = address(node->left.load(std::memory_order_acquire))) nextLevel.push_back(l);
+            if (LockFreeNode* r = address(node->right.load(std::memory_order_acquire))) nextLevel.push_back(r);
+        }
+        level.swap(nextLevel);
+    }
+    return height;
+}
+
+// 5. getNumberOfTreeNodes - count leaves holding real keys
+int LockFreeBinarySearchTree::getNumberOfTreeNodes() const {
+    int count = 0;
+    std::vector<const LockFreeNode*> pending(1, root);
+    while (!pending.empty()) {
+        const LockFreeNode* node = pending.back();
+        pending.pop_back();
+        LockFreeNode* l = address(node->left.load(std::memory_order_acquire));
+        LockFreeNode* r = address(node->right.load(std::memory_order_acquire));
+        if (!l && !r && node->key < INF0)
+            ++count;
+        if (l) pending.push_back(l);
+        if (r) pending.push_back(r);
+    }
+    return count;
+}
+
+// 6. isEmpty - no real keys left
+bool LockFreeBinarySearchTree::isEmpty() const {
+    return getNumberOfTreeNodes() == 0;
+}
+
+// 7. clear - reset S.left to a lone inf0 leaf
+void LockFreeBinarySearchTree::clear() {
+    LockFreeNode* s = address(root->left.load(std::memory_order_relaxed));
+    deleteSubtree(address(s->left.load(std::memory_order_relaxed)));
+    s->left.store(reinterpret_cast<uintptr_t>(new LockFreeNode(INF0)), std::memory_order_release);
+}
+
+// 8. printInOrder - leaves left to right are the keys in order
+void LockFreeBinarySearchTree::printInOrder() const {
+    std::cout << "Performing In-order traversal" << std::endl;
+    std::vector<const LockFreeNode*> pending(1, root);
+    while (!pending.empty()) {
+        const LockFreeNode* node = pending.back();
+        pending.pop_back();
+        LockFreeNode* l = address(node->left.load(std::memory_order_acquire));
+        LockFreeNode* r = address(node->right.load(std::memory_order_acquire));
+        if (!l && !r) {
+            if (node->key < INF0)
+                std::cout << "Node key: " << node->key << std::endl;
+            continue;
+        }
+        if (r) pending.push_back(r);
+        if (l) pending.push_back(l);
+    }
+}
+
+// 9. seek - remember the last untagged edge (ancestor -> successor) above the leaf
+void LockFreeBinarySearchTree::seek(long long key, SeekRecord& record) const {
+    LockFreeNode* s = address(root->left.load(std::memory_order_acquire));
+    record.ancestor = root;
+    record.successor = s;
+    record.parent = s;
+    uintptr_t parentField = s->left.load(std::memory_order_acquire);
+    record.leaf = address(parentField);
+    uintptr_t currentField = childToward(record.leaf, key).load(std::memory_order_acquire);
+    LockFreeNode* current = address(currentField);
+
+    while (current) {
+        if (!(parentField & TAG)) {
+            record.ancestor = record.parent;
+            record.successor = record.leaf;
+        }
+        record.parent = record.leaf;
+        record.leaf = current;
+        parentField = currentField;
+        currentField = childToward(current, key).load(std::memory_order_acquire);
+        current = address(currentField);
+    }
+}
+
+// 10. cleanup - tag the sibling edge, then swing ancestor's edge to the sibling
+bool LockFreeBinarySearchTree::cleanup(long long key, const SeekRecord& record) {
+    LockFreeNode* ancestor = record.ancestor;
+    LockFreeNode* successor = record.successor;
+    LockFreeNode* parent = record.parent;
+
+    std::atomic<uintptr_t>& successorEdge = childToward(ancestor, key);
+    std::atomic<uintptr_t>* childEdge = &parent->left;
+    std::atomic<uintptr_t>* siblingEdge = &parent->right;
+    if (key >= parent->key) {
+        childEdge = &parent->right;
+        siblingEdge = &parent->left;
+    }
+    // If the edge toward key is not flagged, the leaf being removed is the other one
+    if (!(childEdge->load(std::memory_order_acquire) & FLAG))
+        siblingEdge = childEdge;
+
+    siblingEdge->fetch_or(TAG, std::memory_order_acq_rel);
+    uintptr_t sibling = siblingEdge->load(std::memory_order_acquire);
+
+    // The sibling moves up keeping its flag (it may itself be under removal) but not the tag
+    uintptr_t expected = reinterpret_cast<uintptr_t>(successor);
+    if (!successorEdge.compare_exchange_strong(expected, sibling & ~TAG, std::memory_order_acq_rel))
+        return false;
+    retireSplicedNodes(key, successor, parent, address(sibling));
+    return true;
+}
+
+// 11. retireSplicedNodes - every node from successor to parent, plus the flagged leaf beside each
+void LockFreeBinarySearchTree::retireSplicedNodes(long long key, LockFreeNode* successor, LockFreeNode* parent, LockFreeNode* sibling) {
+    EpochDomain& domain = EpochDomain::instance();
+    LockFreeNode* node = successor;
+    while (node != parent) {
+        // Edges between successor and parent are tagged; the one off the path leads to a flagged leaf
+        LockFreeNode* left = address(node->left.load(std::memory_order_acquire));
+        LockFreeNode* right = address(node->right.load(std::memory_order_acquire));
+        LockFreeNode* next = key < node->key ? left : right;
+        domain.retire(key < node->key ? right : left, deleteNode);
+        domain.retire(node, deleteNode);
+        node = next;
+    }
+    LockFreeNode* left = address(parent->left.load(std::memory_order_acquire));
+    LockFreeNode* right = address(parent->right.load(std::memory_order_acquire));
+    domain.retire(left == sibling ? right : left, deleteNode);
+    domain.retire(parent, deleteNode);
+}
+
+// File-local: strip the edge bits
+static LockFreeNode* address(uintptr_t word) {
+    return reinterpret_cast<LockFreeNode*>(word & ~EDGE_BITS);
+}
+
+// File-local: the child edge a search for key follows
+static std::atomic<uintptr_t>& childToward(LockFreeNode* node, long long key) {
+    return key < node->key ? node->left : node->right;
+}
+
+// File-local: deleter handed to the epoch domain
+static void deleteNode(void* node) {
+    delete static_cast<LockFreeNode*>(node);
+}
+
+// File-local: delete a subtree (quiescent only)
+static void deleteSubtree(LockFreeNode* node) {
+    std::vector<LockFreeNode*> pending;
+    if (node) pending.push_back(node);
+    while (!pending.empty()) {
+        LockFreeNode* curr = pending.back();
+        pending.pop_back();
+        if (LockFreeNode* l = address(curr->left.load(std::memory_order_relaxed))) pending.push_back(l);
+        if (LockFreeNode* r = address(curr->right.load(std::memory_order_relaxed))) pending.push_back(r);
+        delete curr;
+    }
+}
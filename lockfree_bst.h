@@ -0,0 +1,165 @@
+/**
+* @author - Hugh Hui
+* @file lockfree_bst.h -  This header file declares the methods in the lockfree_bst.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef LOCKFREEBST_H
+#define LOCKFREEBST_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @struct LockFreeNode
+ * @brief A node of the lock-free external tree.
+ *
+ * Keys live in the leaves; internal nodes only route searches. The two low
+ * bits of each child word mark the edge: FLAG means the leaf below is being
+ * removed, TAG means the edge is frozen while its parent is spliced out.
+ */
+struct LockFreeNode {
+    const long long key;                /**< Key (int range, or one of the three sentinels). */
+    std::atomic<uintptr_t> left;        /**< Left child pointer plus edge bits; 0 for leaves. */
+    std::atomic<uintptr_t> right;       /**< Right child pointer plus edge bits; 0 for leaves. */
+
+    /**
+     * @brief Constructor for LockFreeNode.
+     *
+     * @param k The key of the node.
+     * @param l Left child word (default is a leaf).
+     * @param r Right child word (default is a leaf).
+     */
+    explicit LockFreeNode(long long k, uintptr_t l = 0, uintptr_t r = 0);
+};
+
+/**
+ * @class LockFreeBinarySearchTree
+ * @brief A lock-free external binary search tree (Natarajan and Mittal, PPoPP 2014).
+ *
+ * `contains` only reads. `addToTree` links a new internal node and leaf with
+ * one compare-and-swap. `removeNode` first flags the edge to the leaf, then
+ * tags the sibling edge and swings the closest untagged ancestor edge past
+ * the parent. Any thread that finds a flagged or tagged edge helps finish the
+ * removal, so no operation ever waits for another.
+ *
+ * Spliced-out nodes are handed to the process-wide EpochDomain and freed once
+ * no thread can still be reading them. `getHeightOfTree`,
+ * `getNumberOfTreeNodes`, `isEmpty`, `clear` and `printInOrder` walk the
+ * tree without synchronization and must not run concurrently with updates.
+ */
+class LockFreeBinarySearchTree {
+public:
+    /**
+     * @brief Default constructor; builds the three sentinel keys.
+     */
+    LockFreeBinarySearchTree();
+
+    /**
+     * @brief Destructor; frees the reachable nodes.
+     *
+     * Nodes already retired are freed by the EpochDomain.
+     */
+    ~LockFreeBinarySearchTree();
+
+    LockFreeBinarySearchTree(const LockFreeBinarySearchTree&) = delete;
+    LockFreeBinarySearchTree& operator=(const LockFreeBinarySearchTree&) = delete;
+
+    /**
+     * @brief Adds a key to the tree. Lock-free.
+     *
+     * @param key The key to be added to the tree.
+     * @return True if the key was added, false if it was already present.
+     */
+    bool addToTree(int key);
+
+    /**
+     * @brief Removes a key from the tree. Lock-free.
+     *
+     * @param key The key of the node to remove.
+     * @return True if this call removed the key, false if it wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Checks if the tree contains a key. Lock-free and read-only.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key) const;
+
+    /**
+     * @brief Gets the height of the tree, counting routing and sentinel nodes.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree() const;
+
+    /**
+     * @brief Gets the number of keys in the tree.
+     *
+     * @return The number of keys in the tree.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Checks if the tree holds no keys.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Removes every key; not safe concurrently with other operations.
+     */
+    void clear();
+
+    /**
+     * @brief Performs an in-order traversal of the keys and prints them.
+     */
+    void printInOrder() const;
+
+private:
+    /**
+     * @struct SeekRecord
+     * @brief The edge a removal will swing and the nodes around the target leaf.
+     */
+    struct SeekRecord {
+        LockFreeNode* ancestor;     /**< Owner of the last untagged edge on the path. */
+        LockFreeNode* successor;    /**< Child of `ancestor` on the path. */
+        LockFreeNode* parent;       /**< Parent of `leaf`. */
+        LockFreeNode* leaf;         /**< Leaf where the search ended. */
+    };
+
+    LockFreeNode* root;             /**< Sentinel R (key infinity 2). */
+
+    /**
+     * @brief Walks to the leaf for key, recording the nodes a removal needs.
+     *
+     * @param key The key to search for.
+     * @param record Receives the path summary.
+     */
+    void seek(long long key, SeekRecord& record) const;
+
+    /**
+     * @brief Splices out the parent of a flagged leaf.
+     *
+     * @param key The key the seek record was built for.
+     * @param record The seek record.
+     * @return True if this call performed the splice.
+     */
+    bool cleanup(long long key, const SeekRecord& record);
+
+    /**
+     * @brief Retires the nodes removed by a successful splice.
+     *
+     * @param key The key the seek record was built for.
+     * @param successor First node cut off.
+     * @param parent Last node cut off.
+     * @param sibling The subtree that moved up and stays.
+     */
+    void retireSplicedNodes(long long key, LockFreeNode* successor, LockFreeNode* parent, LockFreeNode* sibling);
+};
+
+#endif // LOCKFREEBST_H
@@ -0,0 +1,67 @@
+/**
+* @author - Hugh Hui
+* @file mapped_file.cpp - Read-only mmap of an input file with sequential read-ahead.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "mapped_file.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Constructor: nothing mapped
+MappedFile::MappedFile()
+    : bytes(nullptr), length(0) {}
+
+// Destructor: unmap
+MappedFile::~MappedFile() {
+    close();
+}
+
+// 1. open - map the whole file read-only
+bool MappedFile::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // mmap rejects a zero length; an empty file maps to nothing
+    if (info.st_size > 0) {
+        void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        madvise(mapping, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+        bytes = static_cast<const char*>(mapping);
+        length = static_cast<size_t>(info.st_size);
+    }
+
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    return true;
+}
+
+// 2. close - unmap
+void MappedFile::close() {
+    if (bytes)
+        munmap(const_cast<char*>(bytes), length);
+    bytes = nullptr;
+    length = 0;
+}
+
+// 3. data - first mapped byte
+const char* MappedFile::data() const {
+    return bytes;
+}
+
+// 4. size - mapped length
+size_t MappedFile::size() const {
+    return length;
+}
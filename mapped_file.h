@@ -0,0 +1,73 @@
+/**
+* @author - Hugh Hui
+* @file mapped_file.h -  This header file declares the methods in the mapped_file.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief A read-only memory mapping of a whole file.
+ *
+ * The file is opened once and mapped with `mmap`. The kernel is told with
+ * `MADV_SEQUENTIAL` that it will be read front to back, so it reads ahead
+ * aggressively and drops pages behind the reader. Parsers work directly on
+ * `data()`; views into it stay valid until the mapping is closed.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Default constructor for MappedFile.
+     *
+     * Nothing is mapped until `open` is called.
+     */
+    MappedFile();
+
+    /**
+     * @brief Destructor for MappedFile.
+     *
+     * Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file, closing any file mapped before.
+     *
+     * @param path The file to map.
+     * @return True if the file was mapped, false if it can't be opened or mapped.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Unmaps the file; views into it become invalid.
+     */
+    void close();
+
+    /**
+     * @brief Gets the first byte of the file.
+     *
+     * @return A pointer to the mapped bytes, or nullptr if nothing is mapped or the file is empty.
+     */
+    const char* data() const;
+
+    /**
+     * @brief Gets the size of the file.
+     *
+     * @return The number of mapped bytes.
+     */
+    size_t size() const;
+
+private:
+    const char* bytes;  /**< Start of the mapping */
+    size_t length;      /**< Length of the mapping */
+};
+
+#endif // MAPPEDFILE_H
@@ -44,14 +44,45 @@
 1/9/2025 - modified by H. Hui; added separate files, DEFINE and comments
 1/14/2025 - modified by H. Hui; modified print, so that it would display to console and write to file; added comments
 2/1/2025 - H. Hui added doxygen formatted comments
+10/19/2026 - modified by H. Hui; run independent test cases on a thread pool with per-case output buffers
+10/19/2026 - modified by H. Hui; only test cases running ahead of the earliest unfinished one hold their output
+10/19/2026 - modified by H. Hui; process file entries concurrently, each with its own output stream
+10/19/2026 - modified by H. Hui; only file entries running ahead of the earliest unfinished one hold their console output
+10/19/2026 - modified by H. Hui; route console and file output through an asynchronous logger
+10/19/2026 - modified by H. Hui; format log lines into a per-thread buffer instead of temporary strings
+10/19/2026 - modified by H. Hui; added per-sink log levels read from the config
+10/19/2026 - modified by H. Hui; added a streaming input mode that runs each action as it is parsed
+10/19/2026 - modified by H. Hui; run binary op-log input files directly
+10/19/2026 - modified by H. Hui; open and map each input file once and parse from the mapping
+10/19/2026 - modified by H. Hui; compile test cases to opcode arrays and run them in an interpreter loop
+10/19/2026 - modified by H. Hui; optional per-test-case hardware counters written to the errorLogFile
+10/19/2026 - modified by H. Hui; optional per-action latency histograms written to the errorLogFile
+10/19/2026 - modified by H. Hui; send redirected output and per-entry output files through the asynchronous logger
 */
 
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <vector>
 #include "json.hpp"
 #include "milestone4.h"
+#include "action_stream.h"
+#include "async_logger.h"
 #include "binary_search_tree.h"
+#include "compiled_actions.h"
+#include "latency_histogram.h"
+#include "mapped_file.h"
+#include "op_log.h"
+#include "perf_counters.h"
+#include "work_stealing_pool.h"
 
 using json = nlohmann::json;
 #define CONFIG_FILE "milestone4_config.json"
@@ -59,6 +90,277 @@ using json = nlohmann::json;
 // Global variable to be used for logging output
 std::ofstream _outFile;
 
+// Most bytes an OrderedOutput holds back at once before later tasks wait their turn
+const size_t MAX_HELD_OUTPUT = 4 * 1024 * 1024;
+
+/**
+ * @class OrderedOutput
+ * @brief Writes the output of tasks that may run out of order to one stream, in task order.
+ *
+ * Each task writes to its own stream. The earliest unfinished task, the head,
+ * writes straight through to the parent stream. A task running ahead of the
+ * head holds its text in memory until every earlier task is finished, then
+ * writes what it held and carries on straight through. Held text is capped at
+ * `maxHeld` bytes over all tasks; a task that would go over waits until it is
+ * the head.
+ *
+ * Only the head writes to the parent, so the parent may be another thread's
+ * stream and needs no lock of its own.
+ */
+class OrderedOutput {
+public:
+    /**
+     * @brief Sets up one stream per task; task 0 starts as the head.
+     *
+     * @param parent Where every task's text ends up.
+     * @param tasks Number of tasks.
+     * @param maxHeld Most bytes held back at once.
+     */
+    OrderedOutput(std::ostream& parent, size_t tasks, size_t maxHeld = MAX_HELD_OUTPUT)
+        : parent(parent), maxHeld(maxHeld), held(0), head(0) {
+        parent.flush();
+        for (size_t i = 0; i < tasks; ++i) {
+            this->tasks.emplace_back(new Task(*this, i));
+        }
+        if (tasks > 0) {
+            this->tasks[0]->isHead.store(true);
+        }
+    }
+
+    /**
+     * @brief Gets the stream a task writes to.
+     *
+     * @param task The task's index.
+     * @return Its stream; only that task may use it.
+     */
+    std::ostream& stream(size_t task) {
+        return tasks[task]->stream;
+    }
+
+    /**
+     * @brief Marks a task's output complete and passes the head on.
+     *
+     * Writes out every finished task the head reaches, then lets the next
+     * unfinished task write straight through. Call on the task's thread once
+     * it no longer writes to its stream.
+     *
+     * @param task The task's index.
+     */
+    void finish(size_t task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks[task]->done = true;
+        size_t first = head;
+        while (head < tasks.size() && tasks[head]->done) {
+            tasks[head]->buffer.passThrough();
+            tasks[head].reset();
+            ++head;
+        }
+        if (head == first) {
+            return;
+        }
+        // Everything written so far reaches the parent before the new head writes
+        parent.flush();
+        if (head < tasks.size()) {
+            tasks[head]->isHead.store(true, std::memory_order_release);
+        }
+        turn.notify_all();
+    }
+
+private:
+    /**
+     * @class HeldBuffer
+     * @brief A task's streambuf: holds text while the task runs ahead, then writes through.
+     */
+    class HeldBuffer : public std::streambuf {
+    public:
+        HeldBuffer(OrderedOutput& output, size_t index) : output(output), index(index) {}
+
+        // Writes the held text to the parent; later text goes straight there
+        void passThrough() {
+            if (passing) {
+                return;
+            }
+            passing = true;
+            output.parent.write(text.data(), static_cast<std::streamsize>(text.size()));
+            output.held.fetch_sub(text.size());
+            std::string().swap(text);
+        }
+
+    protected:
+        std::streamsize xsputn(const char* data, std::streamsize length) override {
+            if (!passing && !output.hold(index, static_cast<size_t>(length))) {
+                passThrough();
+            }
+            if (passing) {
+                output.parent.write(data, length);
+            }
+            else {
+                text.append(data, static_cast<size_t>(length));
+            }
+            return length;
+        }
+
+        int_type overflow(int_type ch) override {
+            if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+                char c = traits_type::to_char_type(ch);
+                xsputn(&c, 1);
+            }
+            return traits_type::not_eof(ch);
+        }
+
+        int sync() override {
+            if (passing) {
+                output.parent.flush();
+            }
+            return 0;
+        }
+
+    private:
+        OrderedOutput& output;  /**< The sequence this task belongs to */
+        size_t index;           /**< The task's position in it */
+        std::string text;       /**< Held text, empty once passing */
+        bool passing = false;   /**< Writing straight to the parent */
+    };
+
+    /**
+     * @struct Task
+     * @brief One task's stream and place in the order.
+     */
+    struct Task {
+        Task(OrderedOutput& output, size_t index) : buffer(output, index), stream(&buffer) {}
+
+        HeldBuffer buffer;                  /**< Holds or passes the task's text */
+        std::ostream stream;                /**< What the task writes to */
+        std::atomic<bool> isHead{ false };  /**< Every earlier task is written */
+        bool done = false;                  /**< Set by finish; guarded by mutex */
+    };
+
+    /**
+     * @brief Reserves room to hold more text, or waits to become the head.
+     *
+     * @param task The asking task's index.
+     * @param length Bytes it wants to hold.
+     * @return True if the text may be held, false if the task is now the head.
+     */
+    bool hold(size_t task, size_t length) {
+        if (tasks[task]->isHead.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (held.fetch_add(length) + length <= maxHeld) {
+            return true;
+        }
+        held.fetch_sub(length);
+        std::unique_lock<std::mutex> lock(mutex);
+        turn.wait(lock, [&] { return tasks[task]->isHead.load(std::memory_order_acquire); });
+        return false;
+    }
+
+    std::ostream& parent;                       /**< Where the text ends up */
+    size_t maxHeld;                             /**< Cap on held bytes */
+    std::atomic<size_t> held;                   /**< Bytes held by all tasks */
+    std::vector<std::unique_ptr<Task>> tasks;   /**< Released once written */
+    std::mutex mutex;                           /**< Guards head and each task's done */
+    std::condition_variable turn;               /**< Signals a new head */
+    size_t head;                                /**< Earliest task not yet written */
+};
+
+// Where this thread's output goes; nullptr means std::cout and _outFile
+thread_local std::ostream* _consoleStream = nullptr;
+thread_local std::ostream* _fileStream = nullptr;
+
+// Background writer for std::cout and _outFile; nullptr means write synchronously
+AsyncLogger* _logger = nullptr;
+
+/**
+ * @struct LoggerStreams
+ * @brief This thread's streams into the installed logger, created on first use.
+ */
+struct LoggerStreams {
+    std::unique_ptr<AsyncLogger::Stream> console;  /**< Goes to std::cout */
+    std::unique_ptr<AsyncLogger::Stream> file;     /**< Goes to _outFile */
+};
+
+thread_local LoggerStreams _loggerStreams;
+
+// Most detailed level each sink writes; set from the config before any worker starts
+LogLevel _consoleLogLevel = LOG_TRACE;
+LogLevel _fileLogLevel = LOG_TRACE;
+LogLevel _maxLogLevel = LOG_TRACE;
+
+/**
+ * @struct DriverOptions
+ * @brief Settings from defaultVariables that apply to every file entry.
+ */
+struct DriverOptions {
+    int testCaseWorkers = 1;        /**< Threads for an entry's test cases; 1 runs them in order */
+    bool streamInput = false;       /**< Run actions while the input is parsed */
+    bool perfCounters = false;      /**< Write per-test-case hardware counters to the errorLogFile */
+    bool latencyHistograms = false; /**< Write per-action latency percentiles to the errorLogFile */
+};
+
+/**
+ * @struct ActionLatencies
+ * @brief One latency histogram per action type, indexed by OpCode.
+ */
+struct ActionLatencies {
+    LatencyHistogram byOpCode[OP_GET_NUMBER_OF_ITEMS + 1];  /**< Only OP_ADD to OP_GET_NUMBER_OF_ITEMS are used */
+
+    void merge(const ActionLatencies& other) {
+        for (int op = OP_ADD; op <= OP_GET_NUMBER_OF_ITEMS; ++op) {
+            byOpCode[op].merge(other.byOpCode[op]);
+        }
+    }
+
+    void clear() {
+        for (int op = OP_ADD; op <= OP_GET_NUMBER_OF_ITEMS; ++op) {
+            byOpCode[op].clear();
+        }
+    }
+};
+
+// Reused per thread so that formatting a log line never allocates
+thread_local char _lineBuffer[512];
+
+/**
+ * @brief Installs or removes the asynchronous logger for std::cout and the output file.
+ *
+ * Only called from the main thread, between batches of work. Removing the
+ * logger flushes it first.
+ *
+ * @param logger The logger to install, or nullptr to go back to synchronous writes.
+ */
+static void setLogger(AsyncLogger* logger) {
+    _loggerStreams.console.reset();
+    _loggerStreams.file.reset();
+    if (_logger) {
+        _logger->flush();
+    }
+    _logger = logger;
+}
+
+/**
+ * @struct OutputRedirect
+ * @brief Points this thread's console and file output at other streams for its lifetime.
+ *
+ * The previous streams are restored on destruction, so redirects nest. That
+ * matters when a thread waiting in the pool runs another entry's or case's task.
+ */
+struct OutputRedirect {
+    std::ostream* savedConsole;
+    std::ostream* savedFile;
+
+    OutputRedirect(std::ostream& console, std::ostream& file)
+        : savedConsole(_consoleStream), savedFile(_fileStream) {
+        _consoleStream = &console;
+        _fileStream = &file;
+    }
+
+    ~OutputRedirect() {
+        _consoleStream = savedConsole;
+        _fileStream = savedFile;
+    }
+};
+
 /**
  * @brief Returns a reference to the output file stream.
  *
@@ -79,6 +381,11 @@ std::ofstream& getOutFile() {
  * @param filePath The path to the output file.
  */
 void setOutFile(const std::string& filePath) {
+    // Queued lines belong to the current file
+    if (_logger) {
+        _logger->flush();
+    }
+
     // Close the current file if it's already open
     if (_outFile.is_open()) {
         _outFile.close();
@@ -91,6 +398,61 @@ void setOutFile(const std::string& filePath) {
     }
 }
 
+/**
+ * @brief Sets the most detailed level written to each sink.
+ *
+ * @param console Level for the console.
+ * @param file Level for the output file.
+ */
+void setLogLevels(LogLevel console, LogLevel file) {
+    _consoleLogLevel = console;
+    _fileLogLevel = file;
+    _maxLogLevel = console > file ? console : file;
+}
+
+/**
+ * @brief Writes one line to the console and the output file, as far as their levels allow.
+ *
+ * @param line The text, with room for one more character after it.
+ * @param length Number of characters in the line, without a newline.
+ * @param level The line's level.
+ */
+static void writeLine(char* line, size_t length, LogLevel level) {
+    bool toConsole = level <= _consoleLogLevel;
+    bool toFile = level <= _fileLogLevel;
+
+    // Both copies go out as one queued record
+    if (_logger && !_consoleStream) {
+        unsigned char sinks = (toConsole ? AsyncLogger::CONSOLE : 0) | (toFile ? AsyncLogger::FILE : 0);
+        if (sinks) {
+            line[length] = '\n';
+            _logger->log(line, length + 1, sinks);
+        }
+        return;
+    }
+
+    // Redirected streams hand text on at task boundaries and reach the logger
+    // through its streams, so a line needs no flush of its own
+    std::string_view text(line, length);
+    line[length] = '\n';
+    if (toConsole) {
+        if (_consoleStream) {
+            _consoleStream->write(line, length + 1);
+        }
+        else {
+            getConsoleStream() << text << std::endl;  // Print to console
+        }
+    }
+    if (toFile) {
+        if (_fileStream) {
+            _fileStream->write(line, length + 1);
+        }
+        else {
+            getFileStream() << text << std::endl;  // Write to file
+        }
+    }
+}
+
 /**
  * @brief Logs a message to both the console and the output file.
  *
@@ -98,94 +460,565 @@ void setOutFile(const std::string& filePath) {
  * message to the output file.
  *
  * @param message The message to log.
+ * @param level The message's level (default is LOG_SUMMARY).
+ */
+void logToFileAndConsole(std::string_view message, LogLevel level) {
+    if (message.size() < sizeof(_lineBuffer)) {
+        std::memcpy(_lineBuffer, message.data(), message.size());
+        writeLine(_lineBuffer, message.size(), level);
+        return;
+    }
+
+    // Too long for the line buffer; only happens for unusual case names
+    std::string line(message);
+    line.push_back('\0');
+    writeLine(&line[0], message.size(), level);
+}
+
+/**
+ * @brief Logs a fixed text followed by an integer, without allocating.
+ *
+ * @param text The text before the number.
+ * @param value The number, formatted with std::to_chars.
+ * @param level The line's level (default is LOG_SUMMARY).
+ */
+void logToFileAndConsole(std::string_view text, int value, LogLevel level) {
+    // Longest int is 11 characters
+    if (text.size() + 12 >= sizeof(_lineBuffer)) {
+        logToFileAndConsole(std::string(text) + std::to_string(value), level);
+        return;
+    }
+    std::memcpy(_lineBuffer, text.data(), text.size());
+    char* end = std::to_chars(_lineBuffer + text.size(), _lineBuffer + sizeof(_lineBuffer) - 1, value).ptr;
+    writeLine(_lineBuffer, end - _lineBuffer, level);
+}
+
+/**
+ * @brief Logs a fixed text followed by another text, without allocating.
+ *
+ * @param text The first part of the line.
+ * @param suffix The second part of the line.
+ * @param level The line's level (default is LOG_SUMMARY).
+ */
+void logToFileAndConsole(std::string_view text, std::string_view suffix, LogLevel level) {
+    if (text.size() + suffix.size() >= sizeof(_lineBuffer)) {
+        logToFileAndConsole(std::string(text) + std::string(suffix), level);
+        return;
+    }
+    std::memcpy(_lineBuffer, text.data(), text.size());
+    std::memcpy(_lineBuffer + text.size(), suffix.data(), suffix.size());
+    writeLine(_lineBuffer, text.size() + suffix.size(), level);
+}
+
+/**
+ * @brief Returns the stream that console-only output should go to.
+ *
+ * This is std::cout, or the test case's or file entry's own ordered stream
+ * while the thread runs one in parallel. With the asynchronous logger installed, std::cout
+ * is reached through a stream that queues each flushed line.
+ *
+ * @return Reference to the console stream.
+ */
+std::ostream& getConsoleStream() {
+    if (_consoleStream)
+        return *_consoleStream;
+    if (_logger) {
+        if (!_loggerStreams.console)
+            _loggerStreams.console.reset(new AsyncLogger::Stream(*_logger, AsyncLogger::CONSOLE));
+        return *_loggerStreams.console;
+    }
+    return std::cout;
+}
+
+/**
+ * @brief Returns the stream that file output should go to.
+ *
+ * This is the global output file, or the current file entry's own stream or
+ * test case's ordered stream while the thread runs one in parallel. With the
+ * asynchronous logger installed, either file is reached through a stream
+ * that queues its text as records; an entry's records name its own file.
+ *
+ * @return Reference to the file stream.
+ */
+std::ostream& getFileStream() {
+    if (_fileStream)
+        return *_fileStream;
+    if (_logger) {
+        if (!_loggerStreams.file)
+            _loggerStreams.file.reset(new AsyncLogger::Stream(*_logger, AsyncLogger::FILE));
+        return *_loggerStreams.file;
+    }
+    return getOutFile();
+}
+
+/**
+ * @brief Logs the header of a test case.
+ *
+ * @param caseName The name of the test case, e.g. "testCase1".
+ */
+static void beginTestCase(std::string_view caseName) {
+    // Log the action group being processed
+    logToFileAndConsole("\n\nProcessing actions for: ", caseName);
+}
+
+/**
+ * @brief Runs one action on the tree and logs the result.
+ *
+ * @tparam Timed If true, the tree call alone is timed; logging is not.
+ * @param bst The BinarySearchTree object to modify.
+ * @param op The action's opcode.
+ * @param key The action's key; only used by add, remove and contains.
+ * @return LatencyClock ticks spent in the tree call, 0 if not Timed.
+ */
+template <bool Timed>
+static inline uint64_t runAction(BinarySearchTree& bst, OpCode op, int key) {
+    uint64_t start = Timed ? LatencyClock::now() : 0;
+    uint64_t ticks = 0;
+    auto stop = [&] {
+        if (Timed) ticks = LatencyClock::now() - start;
+    };
+    switch (op) {
+    case OP_ADD:
+        bst.addToTree(key);
+        stop();
+        if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("Added key: ", key, LOG_TRACE);
+        break;
+    case OP_REMOVE: {
+        bool removed = bst.removeNode(key);
+        stop();
+        if (removed) {
+            if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("Removed key: ", key, LOG_TRACE);
+        }
+        else {
+            if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("Failed to remove key: ", key, LOG_TRACE);
+        }
+        break;
+    }
+    case OP_GET_NUMBER_OF_ITEMS: {
+        int count = bst.getNumberOfTreeNodes();
+        stop();
+        if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("Count of Tree nodes is: ", count, LOG_TRACE);
+        break;
+    }
+    case OP_CONTAINS: {
+        bool found = bst.contains(key);
+        stop();
+        if (found) {
+            if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("TRUE, following key is in the tree: ", key, LOG_TRACE);
+        }
+        else {
+            if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("FALSE, following key is NOT in the tree: ", key, LOG_TRACE);
+        }
+        break;
+    }
+    case OP_IS_EMPTY: {
+        bool empty = bst.isEmpty();
+        stop();
+        if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("Tree is empty: ", empty ? "Yes" : "No", LOG_TRACE);
+        break;
+    }
+    case OP_CLEAR:
+        bst = BinarySearchTree();  // Reset the tree
+        stop();
+        if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("Tree cleared.", LOG_TRACE);
+        break;
+    default:
+        break;
+    }
+    return ticks;
+}
+
+/**
+ * @brief Prints the tree summary at the end of a test case and clears the tree.
+ *
+ * @param bst The BinarySearchTree object the case ran on; cleared at the end.
+ */
+static void endTestCase(BinarySearchTree& bst) {
+    logToFileAndConsole("Height of Tree is: ", bst.getHeightOfTree());
+    logToFileAndConsole("Count of Tree nodes is: ", bst.getNumberOfTreeNodes());
+    logToFileAndConsole("Listed on the next line is the Root node");
+    if (isConsoleLogEnabled(LOG_SUMMARY)) {
+        std::ostream& console = getConsoleStream();
+        bst.printNodeFromTree(bst.getRoot(), console);
+        bst.printBreadthFirst(console);
+        bst.printDepthFirst(console);
+        bst.printInOrder(console);
+        bst.printPostOrder(console);
+        bst.printPreOrder(console);
+    }
+    bst.clear();
+}
+
+/**
+ * @brief Returns this thread's hardware counters, opened on first use.
+ *
+ * @return The calling thread's counters.
+ */
+static PerfCounters& threadPerfCounters() {
+    thread_local PerfCounters counters;
+    return counters;
+}
+
+/**
+ * @brief Returns this thread's scratch histograms for the test case it is running.
+ *
+ * @return The calling thread's histograms.
  */
-void logToFileAndConsole(const std::string& message) {
-    // Get the output file
-    std::ofstream& outFile = getOutFile();
+static ActionLatencies& threadActionLatencies() {
+    thread_local ActionLatencies latencies;
+    return latencies;
+}
 
-    std::cout << message << std::endl;  // Print to console 
-    outFile << message << std::endl;  // Write to file
+/**
+ * @brief Writes a line per action type that ran, e.g. "latency testCase1 add: ...".
+ *
+ * @param out The stream to write to.
+ * @param label The test case name, or "overall".
+ * @param latencies The histograms to write.
+ */
+static void writeActionLatencies(std::ostream& out, std::string_view label, const ActionLatencies& latencies) {
+    std::string name;
+    for (int op = OP_ADD; op <= OP_GET_NUMBER_OF_ITEMS; ++op) {
+        const LatencyHistogram& histogram = latencies.byOpCode[op];
+        if (histogram.getCount() == 0) {
+            continue;
+        }
+        name.assign(label.data(), label.size());
+        name += ' ';
+        name += actionNameForOpCode(static_cast<OpCode>(op));
+        writeLatencySummary(out, name, histogram);
+    }
 }
 
 /**
- * @brief Processes test cases from the JSON input.
+ * @brief Runs the actions of one compiled test case and prints the tree summary.
  *
- * This function processes each test case from the JSON object by executing
+ * @param bst The BinarySearchTree object to modify; cleared at the end.
+ * @param testCase The test case's name and flat action array.
+ * @param profile If not nullptr, receives the counters for the action loop alone.
+ * @param latencies If not nullptr, each action's duration is added here.
+ */
+static void runTestCase(BinarySearchTree& bst, const CompiledTestCase& testCase, PerfSample* profile = nullptr,
+                        ActionLatencies* latencies = nullptr) {
+    beginTestCase(testCase.name);
+
+    if (profile) {
+        threadPerfCounters().start();
+    }
+
+    // Interpreter loop: one switch per action, no JSON or name lookups
+    if (latencies) {
+        for (const CompiledAction& action : testCase.actions) {
+            latencies->byOpCode[action.opcode].record(runAction<true>(bst, action.opcode, action.key));
+        }
+    }
+    else {
+        for (const CompiledAction& action : testCase.actions) {
+            runAction<false>(bst, action.opcode, action.key);
+        }
+    }
+
+    if (profile) {
+        *profile = threadPerfCounters().stop();
+    }
+
+    endTestCase(bst);
+}
+
+/**
+ * @class TreeActionSink
+ * @brief Runs streamed actions on a tree as soon as they are parsed.
+ */
+class TreeActionSink : public ActionSink {
+public:
+    /**
+     * @brief Runs actions on a tree.
+     *
+     * @param bst The tree the actions run on.
+     * @param perfLog If not nullptr, each test case's counters are written here.
+     * @param latencyLog If not nullptr, each test case's action latencies are written here.
+     */
+    explicit TreeActionSink(BinarySearchTree& bst, std::ostream* perfLog = nullptr, std::ostream* latencyLog = nullptr)
+        : bst(bst), perfLog(perfLog), latencyLog(latencyLog) {}
+
+    void beginTestCase(std::string_view caseName) override {
+        ::beginTestCase(caseName);
+        if (perfLog || latencyLog) {
+            this->caseName.assign(caseName.data(), caseName.size());
+        }
+        if (perfLog) {
+            threadPerfCounters().start();
+        }
+    }
+
+    void action(std::string_view name, bool hasKey, int key) override {
+        OpCode op;
+        if (!opCodeForAction(name, op)) {
+            return;
+        }
+        if ((op == OP_ADD || op == OP_REMOVE || op == OP_CONTAINS) && !hasKey) {
+            std::cerr << "Missing key for action: " << name << std::endl;
+            return;
+        }
+        if (latencyLog) {
+            caseLatencies.byOpCode[op].record(runAction<true>(bst, op, key));
+            return;
+        }
+        runAction<false>(bst, op, key);
+    }
+
+    void endTestCase() override {
+        if (perfLog) {
+            // Includes parsing, which overlaps with running in this mode
+            writePerfSample(*perfLog, caseName, threadPerfCounters().stop());
+        }
+        if (latencyLog) {
+            writeActionLatencies(*latencyLog, caseName, caseLatencies);
+            overallLatencies.merge(caseLatencies);
+            caseLatencies.clear();
+        }
+        ::endTestCase(bst);
+    }
+
+    /**
+     * @brief Gets the latencies of every test case so far.
+     *
+     * @return The merged histograms; empty unless a latencyLog was given.
+     */
+    const ActionLatencies& getOverallLatencies() const {
+        return overallLatencies;
+    }
+
+private:
+    BinarySearchTree& bst;              /**< The tree the actions run on */
+    std::ostream* perfLog;              /**< Where counters go, or nullptr */
+    std::ostream* latencyLog;           /**< Where latencies go, or nullptr */
+    std::string caseName;               /**< Name of the running case, kept for the logs */
+    ActionLatencies caseLatencies;      /**< Latencies of the running case */
+    ActionLatencies overallLatencies;   /**< Latencies of the finished cases */
+};
+
+/**
+ * @brief Processes the compiled test cases of an input file.
+ *
+ * This function processes each test case by executing
  * actions such as adding/removing keys from the binary search tree, checking
  * tree properties, and logging results.
  *
- * @param bst The BinarySearchTree object to modify.
- * @param actions The JSON array of actions to process.
+ * Test cases are independent, since each starts from an empty tree. With more
+ * than one worker and more than one case they run on a thread pool, each on
+ * its own tree. The earliest unfinished case writes straight to the output;
+ * a case running ahead of it holds its output in memory until every earlier
+ * case is written (see OrderedOutput), so the output is byte for byte the
+ * same as a serial run and only cases running ahead use memory for it.
+ *
+ * @param bst The BinarySearchTree object to modify; only used when running serially.
+ * @param program The test cases to process.
+ * @param workers Number of pool threads (default is 1, which runs the cases in order on this thread).
+ * @param perfLog If not nullptr, each case's hardware counters are written here in case order.
+ * @param latencyLog If not nullptr, each case's action latencies are written here in case order, then
+ *                   those of every case together under "overall".
  */
-void processTestCase(BinarySearchTree& bst, const json& actions) {
-    // Get the output file
-    std::ofstream& outFile = getOutFile();
-
-    // Iterate over the actions in the cacheManager array
-    for (const auto& actionGroup : actions) {
-        // For each "testCase" object in actionGroup
-        for (const auto& actionSet : actionGroup.items()) {
-            // Log the action group being processed
-            logToFileAndConsole("\n\nProcessing actions for: " + actionSet.key());
-
-            // actionSet.value() is the list of actions under this test case
-            const auto& actions = actionSet.value();
-
-            // Process each action within the test case
-            for (const auto& action : actions) {
-                // Loop through each item in the action and process the operation (add, remove, isEmpty, etc.)
-                for (auto& [key, value] : action.items()) {
-                    if (key == "add") {
-                        int key = value["key"];
-                        bst.addToTree(key);
-                        logToFileAndConsole("Added key: " + std::to_string(key));
-                    }
-                    else if (key == "remove") {
-                        int key = value["key"];
-                        if (bst.removeNode(key)) {
-                            logToFileAndConsole("Removed key: " + std::to_string(key));
-                        }
-                        else {
-                            logToFileAndConsole("Failed to remove key: " + std::to_string(key));
-                        }
-                    }
-                    else if (key == "getNumberOfItems") {
-                        logToFileAndConsole("Count of Tree nodes is: " + std::to_string(bst.getNumberOfTreeNodes()));
-                    }
-                    else if (key == "contains") {
-                        int key = value["key"];
-                        if (bst.contains(key)) {
-                            logToFileAndConsole("TRUE, following key is in the tree: " + std::to_string(key));
-                        }
-                        else {
-                            logToFileAndConsole("FALSE, following key is NOT in the tree: " + std::to_string(key));
-                        }
-                    }
-                    else if (key == "isEmpty") {
-                        bool empty = bst.isEmpty();
-                        logToFileAndConsole("Tree is empty: " + std::string(empty ? "Yes" : "No"));
-                    }
-                    else if (key == "clear") {
-                        bst = BinarySearchTree();  // Reset the tree
-                        logToFileAndConsole("Tree cleared.");
-                    }
+void processTestCase(BinarySearchTree& bst, const CompiledProgram& program, int workers = 1, std::ostream* perfLog = nullptr,
+                     std::ostream* latencyLog = nullptr) {
+    const std::vector<CompiledTestCase>& cases = program.cases;
+    ActionLatencies overall;
+    if (workers <= 1 || cases.size() <= 1) {
+        for (const CompiledTestCase& testCase : cases) {
+            PerfSample profile;
+            ActionLatencies& latencies = threadActionLatencies();
+            runTestCase(bst, testCase, perfLog ? &profile : nullptr, latencyLog ? &latencies : nullptr);
+            if (perfLog) {
+                writePerfSample(*perfLog, testCase.name, profile);
+            }
+            if (latencyLog) {
+                writeActionLatencies(*latencyLog, testCase.name, latencies);
+                overall.merge(latencies);
+                latencies.clear();
+            }
+        }
+        if (latencyLog) {
+            writeActionLatencies(*latencyLog, "overall", overall);
+        }
+        return;
+    }
+
+    std::vector<PerfSample> profiles(perfLog ? cases.size() : 0);
+    // Each case's latency lines; its histograms are merged into overall as soon as it ends
+    std::vector<std::string> latencyReports(latencyLog ? cases.size() : 0);
+    std::mutex overallMutex;
+    // The earliest unfinished case writes straight through; later ones hold their output until then
+    OrderedOutput console(getConsoleStream(), cases.size());
+    OrderedOutput file(getFileStream(), cases.size());
+    std::atomic<int> pending(static_cast<int>(cases.size()));
+    WorkStealingPool pool(workers);
+    for (size_t i = 0; i < cases.size(); ++i) {
+        pool.spawn([&, i] {
+            BinarySearchTree caseTree;
+            {
+                OutputRedirect redirect(console.stream(i), file.stream(i));
+                ActionLatencies& latencies = threadActionLatencies();
+                runTestCase(caseTree, cases[i], perfLog ? &profiles[i] : nullptr, latencyLog ? &latencies : nullptr);
+                if (latencyLog) {
+                    std::ostringstream report;
+                    writeActionLatencies(report, cases[i].name, latencies);
+                    latencyReports[i] = report.str();
+                    std::lock_guard<std::mutex> lock(overallMutex);
+                    overall.merge(latencies);
                 }
+                latencies.clear();
             }
+            console.finish(i);
+            file.finish(i);
+            pending.fetch_sub(1, std::memory_order_release);
+        });
+    }
+    pool.waitFor(pending);
 
-            logToFileAndConsole("Height of Tree is: " + std::to_string(bst.getHeightOfTree()));
-            logToFileAndConsole("Count of Tree nodes is: " + std::to_string(bst.getNumberOfTreeNodes()));
-            logToFileAndConsole("Listed on the next line is the Root node");
-            bst.printNodeFromTree(bst.getRoot());
-            bst.printBreadthFirst();
-            bst.printDepthFirst();
-            bst.printInOrder();
-            bst.printPostOrder();
-            bst.printPreOrder();
-            bst.clear();
+    // Counters and latencies are a few lines per case, written in case order at the end
+    for (size_t i = 0; i < cases.size(); ++i) {
+        if (perfLog) {
+            writePerfSample(*perfLog, cases[i].name, profiles[i]);
         }
+        if (latencyLog) {
+            *latencyLog << latencyReports[i];
+        }
+    }
+    if (latencyLog) {
+        writeActionLatencies(*latencyLog, "overall", overall);
+    }
+}
+
+/**
+ * @brief Processes one entry of the "files" array.
+ *
+ * Reads the entry's input file, runs its test cases and logs the results.
+ * Output goes through `getConsoleStream` and `getFileStream`, so the caller
+ * decides where it ends up.
+ *
+ * The input is either JSON or the binary op-log format (see op_log.h), told
+ * apart by the op-log magic bytes. By default every test case is compiled to
+ * a flat opcode array first, and the arrays are then run by an interpreter
+ * loop, on a thread pool if `testCaseWorkers` is above 1.
+ *
+ * With `streamInput`, each action runs as soon as it is parsed instead, so
+ * memory use does not grow with the file and no action waits for the whole
+ * file to be read. Test cases then run in order on this thread.
+ *
+ * With `perfCounters`, each test case's hardware counters (see
+ * perf_counters.h) are written to the entry's errorLogFile. With
+ * `latencyHistograms`, so are the p50/p90/p99/p99.9/max latencies of each
+ * action type, per test case and for the whole entry. Only the tree call is
+ * timed; trace logging of its result is not.
+ *
+ * @param fileConfig The JSON object with inputFile, outputFile and errorLogFile.
+ * @param options Worker count, input mode and profiling settings.
+ * @return Returns 0 on success or 1 if the input file can't be opened or parsed.
+ */
+static int processFileEntry(const json& fileConfig, const DriverOptions& options) {
+    std::string inputFile = fileConfig["inputFile"];
+    std::string outputFile = fileConfig["outputFile"];
+    std::string errorLogFile = fileConfig["errorLogFile"];
+
+    if (isConsoleLogEnabled(LOG_SUMMARY)) {
+        std::ostream& console = getConsoleStream();
+        console << "inputFile: " << inputFile << std::endl;
+        console << "outputFile: " << outputFile << std::endl;
+        console << "errorLogFile: " << errorLogFile << std::endl;
+    }
+
+    // Log to the file and console
+    logToFileAndConsole("Testing out global.");
+
+    // Open the error log file for writing
+    std::ofstream errorFile(errorLogFile);
+    std::ostream* perfLog = options.perfCounters ? &errorFile : nullptr;
+    std::ostream* latencyLog = options.latencyHistograms ? &errorFile : nullptr;
+
+    // Map the input file; it is read once, straight from the page cache
+    MappedFile input;
+    if (!input.open(inputFile)) {
+        std::cerr << "Error opening input file!" << std::endl;
+        return 1;
+    }
+
+    if (options.streamInput) {
+        BinarySearchTree bst;
+        TreeActionSink sink(bst, perfLog, latencyLog);
+        bool streamed;
+        if (isOpLog(input.data(), input.size())) {
+            streamed = replayOpLog(input.data(), input.size(), sink);
+        }
+        else {
+            streamed = streamActions(input.data(), input.size(), sink);
+        }
+        if (latencyLog) {
+            writeActionLatencies(*latencyLog, "overall", sink.getOverallLatencies());
+        }
+        return streamed ? 0 : 1;
+    }
+
+    // Compile every test case up front; nothing runs if the file is malformed
+    CompiledProgram program;
+    bool compiled;
+    if (isOpLog(input.data(), input.size())) {
+        compiled = compileOpLog(input.data(), input.size(), program);
+    }
+    else {
+        ActionCompiler compiler(program);
+        compiled = streamActions(input.data(), input.size(), compiler);
+    }
+    if (!compiled) {
+        std::cerr << "Error parsing input file!" << std::endl;
+        return 1;
+    }
+
+    BinarySearchTree bst;
+
+    // Process the actions from the test cases
+    processTestCase(bst, program, options.testCaseWorkers, perfLog, latencyLog);
+    return 0;
+}
+
+/**
+ * @brief Warns if an installed logger saw none of the output.
+ *
+ * Every file entry logs at least one summary line, so with any sink enabled
+ * a logger that wrote nothing means some path went around it.
+ *
+ * @param logger The logger of the milestone just run, or nullptr if output was synchronous.
+ */
+static void checkLoggerUsed(AsyncLogger* logger) {
+    if (!logger || (_consoleLogLevel == LOG_OFF && _fileLogLevel == LOG_OFF)) {
+        return;
+    }
+    logger->flush();
+    if (logger->getWrittenCount() == 0) {
+        std::cerr << "Warning: output bypassed the asynchronous logger" << std::endl;
     }
 }
 
+/**
+ * @brief Converts a config level name to a LogLevel.
+ *
+ * @param name "off", "summary" or "trace".
+ * @param fallback Level to use for any other name.
+ * @return The matching level.
+ */
+static LogLevel parseLogLevel(const std::string& name, LogLevel fallback) {
+    if (name == "off") {
+        return LOG_OFF;
+    }
+    if (name == "summary") {
+        return LOG_SUMMARY;
+    }
+    if (name == "trace") {
+        return LOG_TRACE;
+    }
+    std::cerr << "Unknown log level: " << name << std::endl;
+    return fallback;
+}
+
 /**
  * @brief Main function of the program.
  *
@@ -197,6 +1030,13 @@ void processTestCase(BinarySearchTree& bst, const json& actions) {
  *   actions on the BinarySearchTree.
  * - Logs results to both console and output files.
  *
+ * With "fileWorkers" above 1 in defaultVariables and more than one file
+ * entry, the entries run concurrently. Each entry then writes to its own
+ * output file stream. The earliest unfinished entry prints straight to the
+ * console, and an entry running ahead of it holds its console output until
+ * every earlier entry is printed, so the console shows the entries in order.
+ * All entries run even if one fails.
+ *
  * @return Returns 0 on successful execution or 1 if an error occurs.
  */
 int main() {
@@ -214,41 +1054,99 @@ int main() {
 
     auto& milestone4 = config["Milestone4"];
     for (const auto& milestone : milestone4) {
-        for (const auto& fileConfig : milestone["files"]) {
-            std::string inputFile = fileConfig["inputFile"];
-            std::string outputFile = fileConfig["outputFile"];
-            std::string errorLogFile = fileConfig["errorLogFile"];
-
-            std::cout << "inputFile: " << inputFile << std::endl;
-            std::cout << "outputFile: " << outputFile << std::endl;
-            std::cout << "errorLogFile: " << errorLogFile << std::endl;
+        // Test cases and file entries run on this many threads; 1 runs them in order on the main thread
+        DriverOptions options;
+        int fileWorkers = 1;
+        if (milestone.contains("defaultVariables") && !milestone["defaultVariables"].empty()) {
+            options.testCaseWorkers = milestone["defaultVariables"][0].value("testCaseWorkers", 1);
+            fileWorkers = milestone["defaultVariables"][0].value("fileWorkers", 1);
+            // Run actions while the input is parsed instead of after loading it whole
+            options.streamInput = milestone["defaultVariables"][0].value("streamInput", false);
+            options.perfCounters = milestone["defaultVariables"][0].value("perfCounters", false);
+            options.latencyHistograms = milestone["defaultVariables"][0].value("latencyHistograms", false);
+        }
 
-            // Open up the outfile and set the output file path using the setter
-            setOutFile(outputFile);
+        // Console and output file writes go through a background thread unless logQueueCapacity is 0
+        size_t logQueueCapacity = 4096;
+        AsyncLogger::OverflowPolicy logOverflowPolicy = AsyncLogger::BLOCK;
+        if (milestone.contains("defaultVariables") && !milestone["defaultVariables"].empty()) {
+            const json& defaults = milestone["defaultVariables"][0];
+            logQueueCapacity = defaults.value("logQueueCapacity", logQueueCapacity);
+            if (defaults.value("logOverflowPolicy", std::string("block")) == "drop") {
+                logOverflowPolicy = AsyncLogger::DROP;
+            }
+        }
+        // Per-sink verbosity: "trace" logs every action, "summary" only case headers and summaries, "off" nothing
+        LogLevel consoleLogLevel = LOG_TRACE;
+        LogLevel fileLogLevel = LOG_TRACE;
+        if (milestone.contains("defaultVariables") && !milestone["defaultVariables"].empty()) {
+            const json& defaults = milestone["defaultVariables"][0];
+            consoleLogLevel = parseLogLevel(defaults.value("consoleLogLevel", std::string("trace")), LOG_TRACE);
+            fileLogLevel = parseLogLevel(defaults.value("fileLogLevel", std::string("trace")), LOG_TRACE);
+        }
+        setLogLevels(consoleLogLevel, fileLogLevel);
 
-            // Log to the file and console
-            logToFileAndConsole("Testing out global.");
+        std::unique_ptr<AsyncLogger> logger;
+        if (logQueueCapacity > 0) {
+            logger.reset(new AsyncLogger(std::cout, _outFile, logQueueCapacity, logOverflowPolicy));
+        }
+        setLogger(logger.get());
 
-            // Open the error log file for writing
-            std::ofstream errorFile(errorLogFile);
+        const json& files = milestone["files"];
+        if (fileWorkers <= 1 || files.size() <= 1) {
+            for (const auto& fileConfig : files) {
+                // Open up the outfile and set the output file path using the setter
+                setOutFile(fileConfig["outputFile"]);
 
-            // Open input file 
-            std::ifstream file(inputFile);
-            if (!file) {
-                std::cerr << "Error opening input file!" << std::endl;
-                return 1;
+                if (processFileEntry(fileConfig, options) != 0) {
+                    setLogger(nullptr);
+                    return 1;
+                }
             }
+            checkLoggerUsed(logger.get());
+            setLogger(nullptr);
+            continue;
+        }
 
-            // Open the input test file
-            std::ifstream testFile(inputFile);
-
-            json testCases;
-            testFile >> testCases;
-
-            BinarySearchTree bst;
+        // One task per entry, each with its own output file. The earliest unfinished
+        // entry prints straight to the console; later ones hold their console output until then.
+        OrderedOutput console(getConsoleStream(), files.size());
+        std::vector<int> results(files.size(), 0);
+        std::atomic<int> pending(static_cast<int>(files.size()));
+        WorkStealingPool pool(fileWorkers);
+        for (size_t i = 0; i < files.size(); ++i) {
+            pool.spawn([&, i] {
+                std::string outputFile = files[i]["outputFile"];
+                std::ofstream outFile(outputFile);
+                if (!outFile.is_open()) {
+                    std::cerr << "Failed to open file: " << outputFile << std::endl;
+                }
+                {
+                    // The entry's file lines are queued like the global file's, tagged with its stream
+                    std::unique_ptr<AsyncLogger::Stream> loggedFile;
+                    if (_logger) {
+                        loggedFile.reset(new AsyncLogger::Stream(*_logger, AsyncLogger::FILE, &outFile));
+                    }
+                    OutputRedirect redirect(console.stream(i), loggedFile ? *loggedFile : static_cast<std::ostream&>(outFile));
+                    results[i] = processFileEntry(files[i], options);
+                }
+                console.finish(i);
+                if (_logger) {
+                    _logger->flush();  // before outFile closes
+                }
+                pending.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        pool.waitFor(pending);
 
-            // Process the actions from the test cases
-            processTestCase(bst, testCases["cacheManager"]);
+        int result = 0;
+        for (int entryResult : results) {
+            result |= entryResult;
+        }
+        checkLoggerUsed(logger.get());
+        setLogger(nullptr);
+        if (result != 0) {
+            return 1;
         }
     }
 
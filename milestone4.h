@@ -3,11 +3,64 @@
 * @file milestone4.h -  This header file declares the methods in the milestone4.cpp file.
 * 1/31/2025 -  H. Hui created file and added comments.
 * 2/1/2025 - H. Hui added doxygen formatted comments
+* 10/19/2026 - H. Hui added getConsoleStream for per-test-case output buffers
+* 10/19/2026 - H. Hui added getFileStream for per-entry output streams
+* 10/19/2026 - H. Hui added allocation-free logToFileAndConsole overloads
+* 10/19/2026 - H. Hui added per-sink log levels
 */
 #ifndef MILESTONE4_H
 #define MILESTONE4_H
 
-#include <string>
+#include <ostream>
+#include <string_view>
+
+/**
+ * @enum LogLevel
+ * @brief How much a sink writes; each level includes the ones above it.
+ */
+enum LogLevel {
+    LOG_OFF = 0,        /**< Nothing */
+    LOG_SUMMARY = 1,    /**< File headers, test case headers and end-of-case summaries */
+    LOG_TRACE = 2       /**< Also one line per action */
+};
+
+extern LogLevel _consoleLogLevel;   /**< Most detailed level written to the console */
+extern LogLevel _fileLogLevel;      /**< Most detailed level written to the output file */
+extern LogLevel _maxLogLevel;       /**< The more detailed of the two */
+
+/**
+ * @brief Checks whether any sink writes a level.
+ *
+ * Meant for call sites, so a disabled line costs one compare and branch and
+ * its arguments are never evaluated:
+ * `if (isLogEnabled(LOG_TRACE)) logToFileAndConsole("Added key: ", key, LOG_TRACE);`
+ *
+ * @param level The level to test.
+ * @return True if the console or the file writes it.
+ */
+inline bool isLogEnabled(LogLevel level) {
+    return level <= _maxLogLevel;
+}
+
+/**
+ * @brief Checks whether the console writes a level; for console-only output.
+ *
+ * @param level The level to test.
+ * @return True if the console writes it.
+ */
+inline bool isConsoleLogEnabled(LogLevel level) {
+    return level <= _consoleLogLevel;
+}
+
+/**
+ * @brief Sets the most detailed level written to each sink.
+ *
+ * Call before any worker thread starts logging.
+ *
+ * @param console Level for the console.
+ * @param file Level for the output file.
+ */
+void setLogLevels(LogLevel console, LogLevel file);
 
 /**
  * @brief Logs a message to both the console and a file.
@@ -17,10 +70,59 @@
  * for debugging or tracking purposes.
  *
  * @param message The message to be logged.
+ * @param level The message's level; each sink skips it if set below that (default is LOG_SUMMARY).
  *
  * This function is designed to be used across multiple cpp files for
  * consistent logging throughout the program.
  */
-void logToFileAndConsole(const std::string& message);
+void logToFileAndConsole(std::string_view message, LogLevel level = LOG_SUMMARY);
+
+/**
+ * @brief Logs a fixed text followed by an integer to both the console and a file.
+ *
+ * The line is built in a per-thread buffer with std::to_chars, so no heap
+ * memory is allocated: `logToFileAndConsole("Added key: ", key)` replaces
+ * `logToFileAndConsole("Added key: " + std::to_string(key))`.
+ *
+ * @param text The text before the number.
+ * @param value The number to append.
+ * @param level The line's level (default is LOG_SUMMARY).
+ */
+void logToFileAndConsole(std::string_view text, int value, LogLevel level = LOG_SUMMARY);
+
+/**
+ * @brief Logs two texts joined into one line to both the console and a file.
+ *
+ * Built in the same per-thread buffer, so no heap memory is allocated.
+ *
+ * @param text The first part of the line.
+ * @param suffix The second part of the line.
+ * @param level The line's level (default is LOG_SUMMARY).
+ */
+void logToFileAndConsole(std::string_view text, std::string_view suffix, LogLevel level = LOG_SUMMARY);
+
+/**
+ * @brief Returns the stream for output that goes to the console only.
+ *
+ * While a test case or file entry runs on a pool thread this is its own
+ * stream, which holds the text while earlier cases or entries are unfinished
+ * and then writes through, so its output stays in order with its
+ * `logToFileAndConsole` lines. Otherwise it is std::cout.
+ *
+ * @return Reference to the console stream.
+ */
+std::ostream& getConsoleStream();
+
+/**
+ * @brief Returns the stream that `logToFileAndConsole` writes its file copy to.
+ *
+ * While a file entry runs on a pool thread this is the entry's own output
+ * file, reached through the asynchronous logger when one is installed, and
+ * while a test case runs on a pool thread it is the case's own stream, held
+ * like the console one. Otherwise it is the global output file.
+ *
+ * @return Reference to the file stream.
+ */
+std::ostream& getFileStream();
 
 #endif // MILESTONE4_H
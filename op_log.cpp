@@ -0,0 +1,238 @@
+/**
+* @author - Hugh Hui
+* @file op_log.cpp - Compact binary action log: writer, reader and opcode mapping.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "op_log.h"
+#include <algorithm>
+#include <iostream>
+
+static const char MAGIC[4] = { 'B', 'S', 'T', 'L' };
+static const unsigned char VERSION = 1;
+
+// File-local helpers
+static bool hasKeyOperand(OpCode op);
+static uint32_t zigzag(uint32_t delta);
+static uint32_t unzigzag(uint32_t value);
+
+// 1. opCodeForAction - JSON action name to opcode
+bool opCodeForAction(std::string_view name, OpCode& op) {
+    if (name == "add") op = OP_ADD;
+    else if (name == "remove") op = OP_REMOVE;
+    else if (name == "contains") op = OP_CONTAINS;
+    else if (name == "isEmpty") op = OP_IS_EMPTY;
+    else if (name == "clear") op = OP_CLEAR;
+    else if (name == "getNumberOfItems") op = OP_GET_NUMBER_OF_ITEMS;
+    else return false;
+    return true;
+}
+
+// 2. actionNameForOpCode - opcode back to JSON action name
+std::string_view actionNameForOpCode(OpCode op) {
+    switch (op) {
+    case OP_ADD: return "add";
+    case OP_REMOVE: return "remove";
+    case OP_CONTAINS: return "contains";
+    case OP_IS_EMPTY: return "isEmpty";
+    case OP_CLEAR: return "clear";
+    case OP_GET_NUMBER_OF_ITEMS: return "getNumberOfItems";
+    default: return std::string_view();
+    }
+}
+
+// Constructor: write the header
+OpLogWriter::OpLogWriter(std::ostream& out)
+    : out(out), previousKey(0), numberOfActions(0) {
+    out.write(MAGIC, sizeof(MAGIC));
+    out.put(static_cast<char>(VERSION));
+}
+
+// 3. beginTestCase - name record; key deltas restart at 0
+void OpLogWriter::beginTestCase(std::string_view caseName) {
+    out.put(static_cast<char>(OP_BEGIN_CASE));
+    writeVarint(static_cast<uint32_t>(caseName.size()));
+    out.write(caseName.data(), caseName.size());
+    previousKey = 0;
+}
+
+// 4. action - ActionSink entry point used by the converter
+void OpLogWriter::action(std::string_view name, bool hasKey, int key) {
+    OpCode op;
+    if (!opCodeForAction(name, op)) {
+        std::cerr << "Skipping action without an opcode: " << name << std::endl;
+        return;
+    }
+    if (hasKeyOperand(op) && !hasKey) {
+        std::cerr << "Skipping action without a key: " << name << std::endl;
+        return;
+    }
+    writeAction(op, key);
+}
+
+// 5. endTestCase - end marker
+void OpLogWriter::endTestCase() {
+    out.put(static_cast<char>(OP_END_CASE));
+}
+
+// 6. writeAction - opcode, optional key delta, optional payload
+void OpLogWriter::writeAction(OpCode op, int key, std::string_view payload) {
+    out.put(static_cast<char>(payload.empty() ? op : op | OP_HAS_PAYLOAD));
+    if (hasKeyOperand(op)) {
+        // Unsigned arithmetic wraps, so every pair of ints has a delta
+        uint32_t current = static_cast<uint32_t>(key);
+        writeVarint(zigzag(current - previousKey));
+        previousKey = current;
+    }
+    if (!payload.empty()) {
+        writeVarint(static_cast<uint32_t>(payload.size()));
+        out.write(payload.data(), payload.size());
+    }
+    ++numberOfActions;
+}
+
+// 7. getNumberOfActions - action records written so far
+long long OpLogWriter::getNumberOfActions() const {
+    return numberOfActions;
+}
+
+// 8. writeVarint - 7 bits per byte, high bit set on all but the last
+void OpLogWriter::writeVarint(uint32_t value) {
+    char bytes[5];
+    int length = 0;
+    while (value >= 0x80) {
+        bytes[length++] = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    bytes[length++] = static_cast<char>(value);
+    out.write(bytes, length);
+}
+
+// Reader constructor: check the magic and version
+OpLogReader::OpLogReader(const char* data, size_t size)
+    : position(data), end(data + size), previousKey(0), error(false) {
+    if (!isOpLog(data, size)) {
+        fail("bad magic");
+        return;
+    }
+    position += sizeof(MAGIC);
+    if (position == end || static_cast<unsigned char>(*position) != VERSION) {
+        fail("unsupported version");
+        return;
+    }
+    ++position;
+}
+
+// 9. next - decode one record in place
+bool OpLogReader::next(OpLogRecord& record) {
+    if (error || position == end)
+        return false;
+
+    unsigned char code = static_cast<unsigned char>(*position++);
+    record.op = static_cast<OpCode>(code & ~OP_HAS_PAYLOAD);
+    record.key = 0;
+    record.name = std::string_view();
+    record.payload = std::string_view();
+
+    if (record.op == OP_BEGIN_CASE) {
+        uint32_t length;
+        if (!readVarint(length) || length > static_cast<size_t>(end - position))
+            return fail("truncated record");
+        record.name = std::string_view(position, length);
+        position += length;
+        previousKey = 0;
+    }
+    else if (hasKeyOperand(record.op)) {
+        uint32_t delta;
+        if (!readVarint(delta))
+            return fail("truncated record");
+        previousKey += unzigzag(delta);
+        record.key = static_cast<int>(previousKey);
+    }
+    else if (record.op != OP_END_CASE && actionNameForOpCode(record.op).empty()) {
+        return fail("unknown opcode");
+    }
+
+    if (code & OP_HAS_PAYLOAD) {
+        uint32_t length;
+        if (!readVarint(length) || length > static_cast<size_t>(end - position))
+            return fail("truncated record");
+        record.payload = std::string_view(position, length);
+        position += length;
+    }
+    return true;
+}
+
+// 10. hasError - a malformed header or record was found
+bool OpLogReader::hasError() const {
+    return error;
+}
+
+// 11. readVarint - at most 5 bytes, low bits first
+bool OpLogReader::readVarint(uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35 && position != end; shift += 7) {
+        unsigned char c = static_cast<unsigned char>(*position++);
+        value |= static_cast<uint32_t>(c & 0x7F) << shift;
+        if (!(c & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// 12. fail - remember and report an error
+bool OpLogReader::fail(const char* message) {
+    error = true;
+    std::cerr << "Error reading op-log: " << message << std::endl;
+    return false;
+}
+
+// 13. isOpLog - compare the magic
+bool isOpLog(const char* data, size_t size) {
+    return size >= sizeof(MAGIC) && std::equal(MAGIC, MAGIC + sizeof(MAGIC), data);
+}
+
+// 14. replayOpLog - forward every record to the sink
+bool replayOpLog(const char* data, size_t size, ActionSink& sink) {
+    OpLogReader reader(data, size);
+    OpLogRecord record;
+    bool caseOpen = false;
+    while (reader.next(record)) {
+        if (record.op == OP_BEGIN_CASE) {
+            caseOpen = true;
+            sink.beginTestCase(record.name);
+        }
+        else if (!caseOpen) {
+            std::cerr << "Error reading op-log: record outside a test case" << std::endl;
+            return false;
+        }
+        else if (record.op == OP_END_CASE) {
+            caseOpen = false;
+            sink.endTestCase();
+        }
+        else {
+            sink.action(actionNameForOpCode(record.op), hasKeyOperand(record.op), record.key);
+        }
+    }
+    if (reader.hasError())
+        return false;
+    if (caseOpen) {
+        std::cerr << "Error reading op-log: unterminated test case" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// File-local: add, remove and contains carry a key
+static bool hasKeyOperand(OpCode op) {
+    return op == OP_ADD || op == OP_REMOVE || op == OP_CONTAINS;
+}
+
+// File-local: small deltas of either sign become small unsigned values
+static uint32_t zigzag(uint32_t delta) {
+    return (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+}
+
+// File-local: inverse of zigzag
+static uint32_t unzigzag(uint32_t value) {
+    return (value >> 1) ^ (0u - (value & 1u));
+}
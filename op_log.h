@@ -0,0 +1,206 @@
+/**
+* @author - Hugh Hui
+* @file op_log.h -  This header file declares the methods in the op_log.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef OPLOG_H
+#define OPLOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "action_stream.h"
+
+/**
+ * Binary op-log layout
+ *
+ * The file starts with the 4 magic bytes "BSTL" and a version byte (1). Each
+ * record after that is a 1-byte opcode followed by its operands:
+ *
+ * - OP_BEGIN_CASE: varint name length, then the name bytes
+ * - OP_ADD, OP_REMOVE, OP_CONTAINS: zigzag varint of the key minus the
+ *   previous key in the same test case (the first key is relative to 0)
+ * - everything else: no operands
+ *
+ * If the opcode has OP_HAS_PAYLOAD set, a varint length and that many payload
+ * bytes follow the operands. Varints are unsigned LEB128, 7 bits per byte,
+ * low bits first.
+ */
+
+/**
+ * @enum OpCode
+ * @brief One byte per record naming the action.
+ */
+enum OpCode : unsigned char {
+    OP_BEGIN_CASE = 1,          /**< Start of a test case, carries its name */
+    OP_END_CASE = 2,            /**< End of a test case */
+    OP_ADD = 3,                 /**< add, carries a key */
+    OP_REMOVE = 4,              /**< remove, carries a key */
+    OP_CONTAINS = 5,            /**< contains, carries a key */
+    OP_IS_EMPTY = 6,            /**< isEmpty */
+    OP_CLEAR = 7,               /**< clear */
+    OP_GET_NUMBER_OF_ITEMS = 8  /**< getNumberOfItems */
+};
+
+static const unsigned char OP_HAS_PAYLOAD = 0x80;  /**< Opcode flag: a length-prefixed payload follows */
+
+/**
+ * @brief Maps an action name from the JSON input to its opcode.
+ *
+ * @param name The action name, e.g. "add".
+ * @param op Receives the opcode.
+ * @return True if the name has an opcode, false otherwise.
+ */
+bool opCodeForAction(std::string_view name, OpCode& op);
+
+/**
+ * @brief Maps an action opcode back to the JSON action name.
+ *
+ * @param op The opcode.
+ * @return The action name, or an empty view for OP_BEGIN_CASE, OP_END_CASE and unknown codes.
+ */
+std::string_view actionNameForOpCode(OpCode op);
+
+/**
+ * @class OpLogWriter
+ * @brief Writes an op-log, either record by record or as an ActionSink.
+ *
+ * As an ActionSink it can be fed straight from `streamActions`, so JSON
+ * files of any size convert in constant memory. Actions without an opcode
+ * are skipped with a warning on std::cerr.
+ */
+class OpLogWriter : public ActionSink {
+public:
+    /**
+     * @brief Writes the file header.
+     *
+     * @param out The stream to write to, opened in binary mode.
+     */
+    explicit OpLogWriter(std::ostream& out);
+
+    void beginTestCase(std::string_view caseName) override;
+    void action(std::string_view name, bool hasKey, int key) override;
+    void endTestCase() override;
+
+    /**
+     * @brief Writes one action record.
+     *
+     * @param op The action's opcode (not OP_BEGIN_CASE or OP_END_CASE).
+     * @param key The key; only written for OP_ADD, OP_REMOVE and OP_CONTAINS.
+     * @param payload Bytes stored after the key; nothing is stored if empty.
+     */
+    void writeAction(OpCode op, int key, std::string_view payload = std::string_view());
+
+    /**
+     * @brief Gets the number of action records written.
+     *
+     * @return The number of actions.
+     */
+    long long getNumberOfActions() const;
+
+private:
+    std::ostream& out;          /**< Destination stream */
+    uint32_t previousKey;       /**< Base for the next key delta */
+    long long numberOfActions;  /**< Action records written so far */
+
+    /**
+     * @brief Writes an unsigned LEB128 varint.
+     *
+     * @param value The value to write.
+     */
+    void writeVarint(uint32_t value);
+};
+
+/**
+ * @struct OpLogRecord
+ * @brief One decoded record; views point into the log's bytes.
+ */
+struct OpLogRecord {
+    OpCode op;                  /**< Opcode without the payload flag */
+    int key;                    /**< Key for OP_ADD, OP_REMOVE and OP_CONTAINS, 0 otherwise */
+    std::string_view name;      /**< Test case name for OP_BEGIN_CASE, empty otherwise */
+    std::string_view payload;   /**< Payload bytes, empty if the record has none */
+};
+
+/**
+ * @class OpLogReader
+ * @brief Decodes an op-log held in memory, one record at a time.
+ *
+ * Nothing is copied: case names and payloads are views into the bytes given
+ * to the constructor, which must outlive them. Meant for a `MappedFile`.
+ */
+class OpLogReader {
+public:
+    /**
+     * @brief Checks the header; errors are reported by `hasError`.
+     *
+     * @param data The first byte of the log.
+     * @param size The number of bytes in the log.
+     */
+    OpLogReader(const char* data, size_t size);
+
+    /**
+     * @brief Decodes the next record.
+     *
+     * @param record Receives the record.
+     * @return True if a record was decoded, false at the end of the log or on an error.
+     */
+    bool next(OpLogRecord& record);
+
+    /**
+     * @brief Checks whether the header or a record was malformed.
+     *
+     * @return True after an error (already written to std::cerr), false otherwise.
+     */
+    bool hasError() const;
+
+private:
+    const char* position;   /**< Next byte to decode */
+    const char* end;        /**< One past the last byte */
+    uint32_t previousKey;   /**< Base for the next key delta */
+    bool error;             /**< A malformed header or record was found */
+
+    /**
+     * @brief Reads an unsigned LEB128 varint.
+     *
+     * @param value Receives the value.
+     * @return True if a complete varint was read.
+     */
+    bool readVarint(uint32_t& value);
+
+    /**
+     * @brief Records an error and reports it.
+     *
+     * @param message What was wrong.
+     * @return Always false, for returning from `next`.
+     */
+    bool fail(const char* message);
+};
+
+/**
+ * @brief Checks whether bytes in memory hold an op-log.
+ *
+ * @param data The first byte.
+ * @param size The number of bytes.
+ * @return True if the bytes start with the op-log magic.
+ */
+bool isOpLog(const char* data, size_t size);
+
+/**
+ * @brief Decodes an op-log held in memory and passes each action on in file order.
+ *
+ * Payloads are skipped. Calls into the sink use the JSON action names, so a
+ * sink behaves the same whether it is fed from JSON or from an op-log.
+ *
+ * @param data The first byte of the log.
+ * @param size The number of bytes in the log.
+ * @param sink Receives the test cases and actions.
+ * @return True if the whole log was read, false if it is malformed, has a record outside a test case
+ *         or ends inside one (the error is written to std::cerr).
+ */
+bool replayOpLog(const char* data, size_t size, ActionSink& sink);
+
+#endif // OPLOG_H
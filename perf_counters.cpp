@@ -0,0 +1,140 @@
+/**
+* @author - Hugh Hui
+* @file perf_counters.cpp - Per-thread hardware counters through perf_event_open, with a timer-only fallback.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "perf_counters.h"
+#include <cstdint>
+#include <cstring>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// File-local helpers
+static void writeCount(std::ostream& out, const char* name, long long count);
+
+#ifdef __linux__
+// Event type and config for each slot of PerfCounters::fds, in PerfSample order
+static const uint32_t EVENT_TYPES[] = {
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HW_CACHE,
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HARDWARE
+};
+static const uint64_t EVENT_CONFIGS[] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+
+// File-local: open one user-space counter for the calling thread, or return -1
+static int openCounter(uint32_t type, uint64_t config) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+// File-local: read a counter, scaled up if it was multiplexed
+static long long readCounter(int fd) {
+    uint64_t values[3];  // value, time enabled, time running
+    if (read(fd, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[2] == 0)
+        return -1;
+    if (values[2] < values[1])
+        return static_cast<long long>(static_cast<double>(values[0]) * values[1] / values[2]);
+    return static_cast<long long>(values[0]);
+}
+#endif
+
+// Constructor: open whatever counters this machine allows
+PerfCounters::PerfCounters() {
+    for (int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+#ifdef __linux__
+        fds[i] = openCounter(EVENT_TYPES[i], EVENT_CONFIGS[i]);
+#else
+        fds[i] = -1;
+#endif
+    }
+}
+
+// Destructor: close the counters
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int fd : fds)
+        if (fd >= 0)
+            close(fd);
+#endif
+}
+
+// 1. isAvailable - any live counter
+bool PerfCounters::isAvailable() const {
+    for (int fd : fds)
+        if (fd >= 0)
+            return true;
+    return false;
+}
+
+// 2. start - reset and enable every counter, then start the clock
+void PerfCounters::start() {
+#ifdef __linux__
+    for (int fd : fds) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+    started = std::chrono::steady_clock::now();
+}
+
+// 3. stop - stop the clock first so reading the counters is not timed
+PerfSample PerfCounters::stop() {
+    PerfSample sample;
+    sample.ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+#ifdef __linux__
+    long long* counts[NUMBER_OF_EVENTS] = {
+        &sample.cycles, &sample.instructions, &sample.l1dMisses, &sample.llcMisses, &sample.branchMisses
+    };
+    for (int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+        if (fds[i] >= 0) {
+            ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            *counts[i] = readCounter(fds[i]);
+        }
+    }
+#endif
+    return sample;
+}
+
+// 4. writePerfSample - one line per sample, IPC when both inputs exist
+void writePerfSample(std::ostream& out, std::string_view label, const PerfSample& sample) {
+    out << "perf " << label << ": " << static_cast<long long>(sample.ns) << " ns";
+    writeCount(out, "cycles", sample.cycles);
+    writeCount(out, "instructions", sample.instructions);
+    if (sample.cycles > 0 && sample.instructions >= 0)
+        out << ", IPC " << static_cast<double>(sample.instructions) / sample.cycles;
+    writeCount(out, "L1D misses", sample.l1dMisses);
+    writeCount(out, "LLC misses", sample.llcMisses);
+    writeCount(out, "branch misses", sample.branchMisses);
+    out << std::endl;
+}
+
+// File-local: ", name value" or ", name n/a"
+static void writeCount(std::ostream& out, const char* name, long long count) {
+    out << ", " << name << " ";
+    if (count < 0)
+        out << "n/a";
+    else
+        out << count;
+}
@@ -0,0 +1,95 @@
+/**
+* @author - Hugh Hui
+* @file perf_counters.h -  This header file declares the methods in the perf_counters.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include <chrono>
+#include <ostream>
+#include <string_view>
+
+/**
+ * @struct PerfSample
+ * @brief Wall time and hardware counts for one measured region.
+ *
+ * A count of -1 means the counter could not be opened on this machine.
+ */
+struct PerfSample {
+    double ns = 0.0;                /**< Wall-clock nanoseconds; always measured */
+    long long cycles = -1;          /**< CPU cycles */
+    long long instructions = -1;    /**< Instructions retired */
+    long long l1dMisses = -1;       /**< L1 data cache read misses */
+    long long llcMisses = -1;       /**< Last-level cache misses */
+    long long branchMisses = -1;    /**< Mispredicted branches */
+};
+
+/**
+ * @class PerfCounters
+ * @brief Reads the calling thread's hardware counters around a region of code.
+ *
+ * Uses Linux `perf_event_open` with one counter per event, counting user
+ * space only. Events the CPU, kernel or permissions (perf_event_paranoid)
+ * do not allow are skipped one by one. With none available, or on other
+ * systems, only the wall-clock time is measured. Nothing is reported as an
+ * error. Counts are scaled if the kernel had to multiplex counters.
+ *
+ * Counters follow the thread that constructed the object, so each thread
+ * needs its own instance.
+ */
+class PerfCounters {
+public:
+    /**
+     * @brief Opens the counters for the calling thread; they stay stopped until `start`.
+     */
+    PerfCounters();
+
+    /**
+     * @brief Destructor for PerfCounters.
+     *
+     * Closes the counters.
+     */
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Checks whether any hardware counter could be opened.
+     *
+     * @return True if at least one counter is live, false if only time is measured.
+     */
+    bool isAvailable() const;
+
+    /**
+     * @brief Resets and starts the counters and the timer.
+     */
+    void start();
+
+    /**
+     * @brief Stops the counters and the timer.
+     *
+     * @return What was counted since `start`.
+     */
+    PerfSample stop();
+
+private:
+    static const int NUMBER_OF_EVENTS = 5;
+    int fds[NUMBER_OF_EVENTS];                          /**< One perf fd per event, -1 if unavailable */
+    std::chrono::steady_clock::time_point started;      /**< When `start` was called */
+};
+
+/**
+ * @brief Writes a sample as one line, e.g. for the driver's errorLogFile.
+ *
+ * Unavailable counts are written as "n/a".
+ *
+ * @param out The stream to write to.
+ * @param label What was measured, e.g. a test case name.
+ * @param sample The sample to write.
+ */
+void writePerfSample(std::ostream& out, std::string_view label, const PerfSample& sample);
+
+#endif // PERFCOUNTERS_H
@@ -0,0 +1,265 @@
+/**
+* @author - Hugh Hui
+* @file persistent_tree.cpp - Path-copying persistent binary search tree.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "persistent_tree.h"
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using NodePtr = std::shared_ptr<const PersistentNode>;
+
+// File-local helpers
+static int sizeOf(const NodePtr& node);
+static NodePtr makeNode(int key, NodePtr left, NodePtr right);
+static NodePtr rebuildPath(const std::vector<const PersistentNode*>& path, int key, NodePtr subtree);
+
+// Nodes waiting to be released by the outermost ~PersistentNode on this thread, or nullptr
+static thread_local std::vector<NodePtr>* pendingRelease = nullptr;
+
+// PersistentNode constructor: size follows from the children
+PersistentNode::PersistentNode(int k, std::shared_ptr<const PersistentNode> l, std::shared_ptr<const PersistentNode> r)
+    : key(k), numberOfNodes(1 + sizeOf(l) + sizeOf(r)), left(std::move(l)), right(std::move(r)) {}
+
+// PersistentNode destructor: hand the children to the outermost destructor's loop
+PersistentNode::~PersistentNode() {
+    if (pendingRelease) {
+        // Called from the loop below; dropping the children here would recurse
+        if (left) pendingRelease->push_back(std::move(left));
+        if (right) pendingRelease->push_back(std::move(right));
+        return;
+    }
+    std::vector<NodePtr> pending;
+    pendingRelease = &pending;
+    if (left) pending.push_back(std::move(left));
+    if (right) pending.push_back(std::move(right));
+    while (!pending.empty()) {
+        // Dropping the reference may destroy the node, which pushes its children
+        NodePtr curr = std::move(pending.back());
+        pending.pop_back();
+    }
+    pendingRelease = nullptr;
+}
+
+// Constructor: initialize empty tree
+PersistentBinarySearchTree::PersistentBinarySearchTree()
+    : root(nullptr) {}
+
+// Destructor: release this version
+PersistentBinarySearchTree::~PersistentBinarySearchTree() {
+    replaceRoot(nullptr);
+}
+
+// Copy assignment: share the other version
+PersistentBinarySearchTree& PersistentBinarySearchTree::operator=(const PersistentBinarySearchTree& other) {
+    if (this != &other)
+        replaceRoot(other.root);
+    return *this;
+}
+
+// Move assignment: take the other version
+PersistentBinarySearchTree& PersistentBinarySearchTree::operator=(PersistentBinarySearchTree&& other) noexcept {
+    if (this != &other) {
+        replaceRoot(std::move(other.root));
+        other.root = nullptr;
+    }
+    return *this;
+}
+
+// 1. snapshot - one reference count bump
+PersistentBinarySearchTree PersistentBinarySearchTree::snapshot() const {
+    return *this;
+}
+
+// 2. addToTree - copy the search path and hang a new leaf off its end
+void PersistentBinarySearchTree::addToTree(int key) {
+    std::vector<const PersistentNode*> path;
+    const PersistentNode* curr = root.get();
+    while (curr) {
+        if (key == curr->key)
+            return; // no duplicates
+        path.push_back(curr);
+        curr = key < curr->key ? curr->left.get() : curr->right.get();
+    }
+    replaceRoot(rebuildPath(path, key, makeNode(key, nullptr, nullptr)));
+}
+
+// 3. removeNode - copy the search path and splice in the replacement subtree
+bool PersistentBinarySearchTree::removeNode(int key) {
+    std::vector<const PersistentNode*> path;
+    const PersistentNode* curr = root.get();
+    while (curr && curr->key != key) {
+        path.push_back(curr);
+        curr = key < curr->key ? curr->left.get() : curr->right.get();
+    }
+    if (!curr)
+        return false;
+
+    NodePtr replacement;
+    if (!curr->left) {
+        replacement = curr->right;
+    } else if (!curr->right) {
+        replacement = curr->left;
+    } else {
+        // Two children: the in-order successor takes this node's place, and
+        // the path down to it in the right subtree is copied without it.
+        std::vector<const PersistentNode*> successorPath;
+        const PersistentNode* succ = curr->right.get();
+        while (succ->left) {
+            successorPath.push_back(succ);
+            succ = succ->left.get();
+        }
+        NodePtr newRight = succ->right;
+        for (auto it = successorPath.rbegin(); it != successorPath.rend(); ++it)
+            newRight = makeNode((*it)->key, newRight, (*it)->right);
+        replacement = makeNode(succ->key, curr->left, newRight);
+    }
+    replaceRoot(rebuildPath(path, key, replacement));
+    return true;
+}
+
+// 4. getHeightOfTree - level-by-level count, no recursion
+int PersistentBinarySearchTree::getHeightOfTree() const {
+    int height = 0;
+    std::vector<const PersistentNode*> level;
+    std::vector<const PersistentNode*> nextLevel;
+    if (root) level.push_back(root.get());
+    while (!level.empty()) {
+        ++height;
+        nextLevel.clear();
+        for (const PersistentNode* node : level) {
+            if (node->left) nextLevel.push_back(node->left.get());
+            if (node->right) nextLevel.push_back(node->right.get());
+        }
+        level.swap(nextLevel);
+    }
+    return height;
+}
+
+// 5. getNumberOfTreeNodes - sizes are stored in the nodes
+int PersistentBinarySearchTree::getNumberOfTreeNodes() const {
+    return sizeOf(root);
+}
+
+// 6. contains - Check if a key is in this version
+bool PersistentBinarySearchTree::contains(int key) const {
+    const PersistentNode* curr = root.get();
+    while (curr) {
+        if (key == curr->key)
+            return true;
+        else if (key < curr->key)
+            curr = curr->left.get();
+        else
+            curr = curr->right.get();
+    }
+    return false;
+}
+
+// 7. getRoot - Getter for the root node of this version
+const PersistentNode* PersistentBinarySearchTree::getRoot() const {
+    return root.get();
+}
+
+// 8. isEmpty - Check if this version is empty
+bool PersistentBinarySearchTree::isEmpty() const {
+    return root == nullptr;
+}
+
+// 9. clear - drop this version
+void PersistentBinarySearchTree::clear() {
+    replaceRoot(nullptr);
+}
+
+// 10. printNodeFromTree - print only the key of a node
+void PersistentBinarySearchTree::printNodeFromTree(const PersistentNode* node) const {
+    if (!node) {
+        std::cout << "Node is null" << std::endl;
+        return;
+    }
+    std::cout << "Node key: " << node->key << std::endl;
+}
+
+// 11. printInOrder - print the tree in an in-order traversal
+void PersistentBinarySearchTree::printInOrder() const {
+    std::cout << "Performing In-order traversal" << std::endl;
+    std::vector<const PersistentNode*> pending;
+    const PersistentNode* curr = root.get();
+    while (curr || !pending.empty()) {
+        while (curr) {
+            pending.push_back(curr);
+            curr = curr->left.get();
+        }
+        curr = pending.back();
+        pending.pop_back();
+        std::cout << "Node key: " << curr->key << std::endl;
+        curr = curr->right.get();
+    }
+}
+
+// 12. printPreOrder - print the tree in a Pre-order traversal
+void PersistentBinarySearchTree::printPreOrder() const {
+    std::cout << "Performing Pre-order traversal" << std::endl;
+    std::vector<const PersistentNode*> pending;
+    if (root) pending.push_back(root.get());
+    while (!pending.empty()) {
+        const PersistentNode* node = pending.back();
+        pending.pop_back();
+        std::cout << "Node key: " << node->key << std::endl;
+        if (node->right) pending.push_back(node->right.get());
+        if (node->left) pending.push_back(node->left.get());
+    }
+}
+
+// 13. printPostOrder - print the tree in a Post-order traversal
+void PersistentBinarySearchTree::printPostOrder() const {
+    std::cout << "Performing Post-order traversal" << std::endl;
+    // Reverse of a root-right-left walk is left-right-root
+    std::vector<const PersistentNode*> pending;
+    std::vector<int> output;
+    if (root) pending.push_back(root.get());
+    while (!pending.empty()) {
+        const PersistentNode* node = pending.back();
+        pending.pop_back();
+        output.push_back(node->key);
+        if (node->left) pending.push_back(node->left.get());
+        if (node->right) pending.push_back(node->right.get());
+    }
+    for (auto it = output.rbegin(); it != output.rend(); ++it)
+        std::cout << "Node key: " << *it << std::endl;
+}
+
+// 14. printDepthFirst - header only, no node dump
+void PersistentBinarySearchTree::printDepthFirst() const {
+    std::cout << "Performing Depth First via PreOrder traversal" << std::endl;
+}
+
+// 15. printBreadthFirst - header only, no node dump
+void PersistentBinarySearchTree::printBreadthFirst() const {
+    std::cout << "Performing Breadth First traversal" << std::endl;
+}
+
+// 16. replaceRoot - swap in a new version; the old one is released by ~PersistentNode
+void PersistentBinarySearchTree::replaceRoot(std::shared_ptr<const PersistentNode> newRoot) {
+    root = std::move(newRoot);
+}
+
+// File-local: size of a possibly empty subtree
+static int sizeOf(const NodePtr& node) {
+    return node ? node->numberOfNodes : 0;
+}
+
+// File-local: allocate a node; it is only ever reached through pointers to const
+static NodePtr makeNode(int key, NodePtr left, NodePtr right) {
+    return std::make_shared<PersistentNode>(key, std::move(left), std::move(right));
+}
+
+// File-local: copy the nodes of path bottom-up, replacing the child towards key with subtree
+static NodePtr rebuildPath(const std::vector<const PersistentNode*>& path, int key, NodePtr subtree) {
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        const PersistentNode* node = *it;
+        subtree = key < node->key ? makeNode(node->key, std::move(subtree), node->right)
+                                  : makeNode(node->key, node->left, std::move(subtree));
+    }
+    return subtree;
+}
@@ -0,0 +1,199 @@
+/**
+* @author - Hugh Hui
+* @file persistent_tree.h -  This header file declares the methods in the persistent_tree.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef PERSISTENTTREE_H
+#define PERSISTENTTREE_H
+
+#include <memory>
+
+/**
+ * @struct PersistentNode
+ * @brief An immutable node shared between versions of a PersistentBinarySearchTree.
+ *
+ * Once published a node is never modified, so any number of versions and
+ * threads may read it. It is freed when the last version referencing it goes away.
+ */
+struct PersistentNode {
+    int key;                                      /**< Key for the tree node. */
+    int numberOfNodes;                            /**< Total nodes in the subtree rooted at this node. */
+    std::shared_ptr<const PersistentNode> left;   /**< Pointer to the left child. */
+    std::shared_ptr<const PersistentNode> right;  /**< Pointer to the right child. */
+
+    /**
+     * @brief Constructor for PersistentNode.
+     *
+     * @param k The key of the node.
+     * @param l Pointer to the left child.
+     * @param r Pointer to the right child.
+     */
+    PersistentNode(int k, std::shared_ptr<const PersistentNode> l, std::shared_ptr<const PersistentNode> r);
+
+    /**
+     * @brief Destructor for PersistentNode.
+     *
+     * Runs once the last reference is gone. Children that this node owned
+     * alone are freed in a loop on the calling thread instead of by
+     * recursion, so a long chain cannot overflow the stack.
+     */
+    ~PersistentNode();
+};
+
+/**
+ * @class PersistentBinarySearchTree
+ * @brief A binary search tree whose old versions stay readable after updates.
+ *
+ * `addToTree` and `removeNode` copy only the nodes on the search path and
+ * share every other subtree with the previous version, so an update costs
+ * O(height) new nodes. `snapshot` copies one reference-counted pointer, so it
+ * is O(1), and a snapshot never changes afterwards. Nodes are reclaimed by
+ * reference counting when no version uses them anymore.
+ *
+ * A tree object is not itself synchronized: one thread updates it and takes
+ * snapshots, and the snapshots may then be read from any thread without
+ * locks while the writer keeps going.
+ */
+class PersistentBinarySearchTree {
+public:
+    /**
+     * @brief Default constructor for PersistentBinarySearchTree.
+     *
+     * Initializes an empty tree.
+     */
+    PersistentBinarySearchTree();
+
+    /**
+     * @brief Destructor; releases this version's reference to the nodes.
+     *
+     * Nodes still used by other versions stay alive.
+     */
+    ~PersistentBinarySearchTree();
+
+    PersistentBinarySearchTree(const PersistentBinarySearchTree& other) = default;
+    PersistentBinarySearchTree(PersistentBinarySearchTree&& other) noexcept = default;
+
+    /**
+     * @brief Makes this tree share the other tree's current version in O(1).
+     *
+     * @param other The tree to share.
+     * @return Reference to this tree.
+     */
+    PersistentBinarySearchTree& operator=(const PersistentBinarySearchTree& other);
+
+    /**
+     * @brief Takes over the other tree's version in O(1); the other tree is left empty.
+     *
+     * @param other The tree to move from.
+     * @return Reference to this tree.
+     */
+    PersistentBinarySearchTree& operator=(PersistentBinarySearchTree&& other) noexcept;
+
+    /**
+     * @brief Takes an O(1) read-only view of the current version.
+     *
+     * @return A tree sharing every node with this one.
+     */
+    PersistentBinarySearchTree snapshot() const;
+
+    /**
+     * @brief Adds a key, copying only the nodes on its search path.
+     *
+     * @param key The key to be added to the tree.
+     */
+    void addToTree(int key);
+
+    /**
+     * @brief Removes a key, copying only the nodes on its search path.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the node was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Gets the height of the tree.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree() const;
+
+    /**
+     * @brief Gets the number of nodes in the tree in O(1).
+     *
+     * @return The number of nodes in the tree.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Checks if the tree contains a node with the specified key.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key) const;
+
+    /**
+     * @brief Gets the root node of this version.
+     *
+     * @return A pointer to the root node, valid while this version is alive.
+     */
+    const PersistentNode* getRoot() const;
+
+    /**
+     * @brief Checks if the tree is empty.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Drops this version's nodes; snapshots are unaffected.
+     */
+    void clear();
+
+    /**
+     * @brief Prints the key of a specific node.
+     *
+     * @param node A pointer to the node whose data is to be printed.
+     */
+    void printNodeFromTree(const PersistentNode* node) const;
+
+    /**
+     * @brief Performs an in-order traversal of the tree and prints the nodes.
+     */
+    void printInOrder() const;
+
+    /**
+     * @brief Performs a pre-order traversal of the tree and prints the nodes.
+     */
+    void printPreOrder() const;
+
+    /**
+     * @brief Performs a post-order traversal of the tree and prints the nodes.
+     */
+    void printPostOrder() const;
+
+    /**
+     * @brief Prints the depth-first traversal header, as BinarySearchTree does.
+     */
+    void printDepthFirst() const;
+
+    /**
+     * @brief Prints the breadth-first traversal header, as BinarySearchTree does.
+     */
+    void printBreadthFirst() const;
+
+private:
+    std::shared_ptr<const PersistentNode> root; /**< Root of this version */
+
+    /**
+     * @brief Replaces the root, releasing the old version.
+     *
+     * @param newRoot The root of the new version.
+     */
+    void replaceRoot(std::shared_ptr<const PersistentNode> newRoot);
+};
+
+#endif // PERSISTENTTREE_H
@@ -0,0 +1,315 @@
+/**
+* @author - Hugh Hui
+* @file rcu_bst.cpp - Read-copy-update binary search tree for read-mostly workloads.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "rcu_bst.h"
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#ifdef __linux__
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Retired nodes allowed to pile up before a writer runs a grace period
+static const size_t RETIRE_BATCH = 128;
+
+/**
+ * @struct ReaderRecord
+ * @brief Per-thread read-side state. `counter` is 0 outside read sections,
+ *        otherwise the grace period number seen on entry.
+ */
+struct ReaderRecord {
+    std::atomic<uint64_t> counter{0};   /**< Written only by the owning thread. */
+    std::atomic<bool> inUse{false};     /**< Claimed by a live thread. */
+    ReaderRecord* next = nullptr;       /**< Link in the registry. */
+    int nesting = 0;                    /**< Owner only. */
+};
+
+/**
+ * @struct ReaderRecordOwner
+ * @brief Hands the record back when the thread exits.
+ */
+struct ReaderRecordOwner {
+    ReaderRecord* record = nullptr;
+    ~ReaderRecordOwner() {
+        if (record) {
+            record->counter.store(0, std::memory_order_release);
+            record->inUse.store(false, std::memory_order_release);
+        }
+    }
+};
+
+static std::atomic<ReaderRecord*> readers(nullptr);     // Registry of every reader record
+static std::atomic<uint64_t> gracePeriod(1);            // Grace period number; written under gracePeriodMutex
+static std::mutex gracePeriodMutex;                     // One grace period at a time across all trees
+static thread_local ReaderRecordOwner localReader;
+
+// File-local helpers
+static bool membarrierAvailable();
+static ReaderRecord* readerRecord();
+static void heavyBarrier();
+static void deleteNodes(RcuNode* node);
+
+// RcuNode constructor
+RcuNode::RcuNode(int k, RcuNode* l, RcuNode* r)
+    : key(k), left(l), right(r) {}
+
+// RcuReadGuard constructor: announce the grace period we are reading in
+RcuReadGuard::RcuReadGuard() {
+    ReaderRecord* record = readerRecord();
+    if (record->nesting++ > 0)
+        return;
+    record->counter.store(gracePeriod.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    // With membarrier the writer supplies the hardware fence on our behalf
+    if (membarrierAvailable())
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    else
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+// RcuReadGuard destructor: leave the read section
+RcuReadGuard::~RcuReadGuard() {
+    ReaderRecord* record = localReader.record;
+    if (--record->nesting > 0)
+        return;
+    record->counter.store(0, std::memory_order_release);
+}
+
+// Constructor: initialize empty tree
+RcuBinarySearchTree::RcuBinarySearchTree()
+    : root(nullptr) {}
+
+// Destructor: no reader may still be inside this tree
+RcuBinarySearchTree::~RcuBinarySearchTree() {
+    deleteNodes(root.load(std::memory_order_relaxed));
+    for (RcuNode* node : retired)
+        delete node;
+}
+
+// 1. addToTree - a fully built leaf is published with one release store
+void RcuBinarySearchTree::addToTree(int key) {
+    std::lock_guard<std::mutex> guard(writerMutex);
+    std::atomic<RcuNode*>* slot = &root;
+    while (RcuNode* curr = slot->load(std::memory_order_relaxed)) {
+        if (key == curr->key)
+            return; // no duplicates
+        slot = key < curr->key ? &curr->left : &curr->right;
+    }
+    slot->store(new RcuNode(key), std::memory_order_release);
+}
+
+// 2. removeNode - bypass, or replace with a successor copy and wait before unlinking the successor
+bool RcuBinarySearchTree::removeNode(int key) {
+    std::lock_guard<std::mutex> guard(writerMutex);
+    std::atomic<RcuNode*>* slot = &root;
+    RcuNode* node = slot->load(std::memory_order_relaxed);
+    while (node && node->key != key) {
+        slot = key < node->key ? &node->left : &node->right;
+        node = slot->load(std::memory_order_relaxed);
+    }
+    if (!node)
+        return false;
+
+    RcuNode* left = node->left.load(std::memory_order_relaxed);
+    RcuNode* right = node->right.load(std::memory_order_relaxed);
+    if (!left || !right) {
+        slot->store(left ? left : right, std::memory_order_release);
+        retire(node);
+        return true;
+    }
+
+    std::atomic<RcuNode*>* successorSlot = &node->right;
+    RcuNode* successor = right;
+    while (RcuNode* next = successor->left.load(std::memory_order_relaxed)) {
+        successorSlot = &successor->left;
+        successor = next;
+    }
+    RcuNode* copy = new RcuNode(successor->key, left, right);
+    slot->store(copy, std::memory_order_release);
+    retire(node);
+
+    // A reader still at the old node may be heading for the successor; let it
+    // finish before the successor disappears from the right subtree.
+    synchronizeLocked();
+    if (successorSlot == &node->right)
+        successorSlot = &copy->right;
+    successorSlot->store(successor->right.load(std::memory_order_relaxed), std::memory_order_release);
+    retire(successor);
+    return true;
+}
+
+// 3. contains - plain walk inside a read section
+bool RcuBinarySearchTree::contains(int key) const {
+    RcuReadGuard guard;
+    const RcuNode* curr = root.load(std::memory_order_acquire);
+    while (curr) {
+        if (key == curr->key)
+            return true;
+        curr = key < curr->key ? curr->left.load(std::memory_order_acquire)
+                               : curr->right.load(std::memory_order_acquire);
+    }
+    return false;
+}
+
+// 4. getHeightOfTree - level-by-level count inside a read section
+int RcuBinarySearchTree::getHeightOfTree() const {
+    RcuReadGuard guard;
+    int height = 0;
+    std::vector<const RcuNode*> level;
+    std::vector<const RcuNode*> nextLevel;
+    if (const RcuNode* top = root.load(std::memory_order_acquire))
+        level.push_back(top);
+    while (!level.empty()) {
+        ++height;
+        nextLevel.clear();
+        for (const RcuNode* node : level) {
+            if (const RcuNode* l = node->left.load(std::memory_order_acquire)) nextLevel.push_back(l);
+            if (const RcuNode* r = node->right.load(std::memory_order_acquire)) nextLevel.push_back(r);
+        }
+        level.swap(nextLevel);
+    }
+    return height;
+}
+
+// 5. getNumberOfTreeNodes - count inside a read section
+int RcuBinarySearchTree::getNumberOfTreeNodes() const {
+    RcuReadGuard guard;
+    int count = 0;
+    std::vector<const RcuNode*> pending;
+    if (const RcuNode* top = root.load(std::memory_order_acquire))
+        pending.push_back(top);
+    while (!pending.empty()) {
+        const RcuNode* node = pending.back();
+        pending.pop_back();
+        ++count;
+        if (const RcuNode* l = node->left.load(std::memory_order_acquire)) pending.push_back(l);
+        if (const RcuNode* r = node->right.load(std::memory_order_acquire)) pending.push_back(r);
+    }
+    return count;
+}
+
+// 6. isEmpty - Check if the tree is empty
+bool RcuBinarySearchTree::isEmpty() const {
+    return root.load(std::memory_order_acquire) == nullptr;
+}
+
+// 7. clear - unpublish the whole tree, then free it after a grace period
+void RcuBinarySearchTree::clear() {
+    std::lock_guard<std::mutex> guard(writerMutex);
+    RcuNode* old = root.exchange(nullptr, std::memory_order_acq_rel);
+    synchronizeLocked();
+    deleteNodes(old);
+}
+
+// 8. printInOrder - print the tree in an in-order traversal
+void RcuBinarySearchTree::printInOrder() const {
+    RcuReadGuard guard;
+    std::cout << "Performing In-order traversal" << std::endl;
+    std::vector<const RcuNode*> pending;
+    const RcuNode* curr = root.load(std::memory_order_acquire);
+    while (curr || !pending.empty()) {
+        while (curr) {
+            pending.push_back(curr);
+            curr = curr->left.load(std::memory_order_acquire);
+        }
+        curr = pending.back();
+        pending.pop_back();
+        std::cout << "Node key: " << curr->key << std::endl;
+        curr = curr->right.load(std::memory_order_acquire);
+    }
+}
+
+// 9. synchronize - public grace period
+void RcuBinarySearchTree::synchronize() {
+    std::lock_guard<std::mutex> guard(writerMutex);
+    synchronizeLocked();
+}
+
+// 10. retire - batch frees so most removals never wait
+void RcuBinarySearchTree::retire(RcuNode* node) {
+    retired.push_back(node);
+    if (retired.size() >= RETIRE_BATCH)
+        synchronizeLocked();
+}
+
+// 11. synchronizeLocked - start a new grace period and wait out older readers
+void RcuBinarySearchTree::synchronizeLocked() {
+    {
+        std::lock_guard<std::mutex> guard(gracePeriodMutex);
+        uint64_t target = gracePeriod.load(std::memory_order_relaxed) + 1;
+        gracePeriod.store(target, std::memory_order_relaxed);
+        heavyBarrier();
+        for (ReaderRecord* record = readers.load(std::memory_order_acquire); record; record = record->next) {
+            for (int spins = 0;; ++spins) {
+                uint64_t seen = record->counter.load(std::memory_order_acquire);
+                if (seen == 0 || seen >= target)
+                    break;
+                if (spins > 64)
+                    std::this_thread::yield();
+            }
+        }
+    }
+    for (RcuNode* node : retired)
+        delete node;
+    retired.clear();
+}
+
+// File-local: register once for expedited membarrier; false means readers must fence themselves
+static bool membarrierAvailable() {
+#ifdef __linux__
+    static const bool available =
+        syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+    return available;
+#else
+    return false;
+#endif
+}
+
+// File-local: claim a free reader record or append a new one
+static ReaderRecord* readerRecord() {
+    if (localReader.record)
+        return localReader.record;
+    for (ReaderRecord* record = readers.load(std::memory_order_acquire); record; record = record->next) {
+        bool expected = false;
+        if (!record->inUse.load(std::memory_order_relaxed) &&
+            record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            localReader.record = record;
+            return record;
+        }
+    }
+    ReaderRecord* record = new ReaderRecord();
+    record->inUse.store(true, std::memory_order_relaxed);
+    ReaderRecord* head = readers.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!readers.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+    localReader.record = record;
+    return record;
+}
+
+// File-local: full barrier on every thread of the process (or just this one as a fallback)
+static void heavyBarrier() {
+#ifdef __linux__
+    if (membarrierAvailable()) {
+        syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+        return;
+    }
+#endif
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+// File-local: delete a subtree that no reader can reach anymore
+static void deleteNodes(RcuNode* node) {
+    std::vector<RcuNode*> pending;
+    if (node) pending.push_back(node);
+    while (!pending.empty()) {
+        RcuNode* curr = pending.back();
+        pending.pop_back();
+        if (RcuNode* l = curr->left.load(std::memory_order_relaxed)) pending.push_back(l);
+        if (RcuNode* r = curr->right.load(std::memory_order_relaxed)) pending.push_back(r);
+        delete curr;
+    }
+}
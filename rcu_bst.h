@@ -0,0 +1,160 @@
+/**
+* @author - Hugh Hui
+* @file rcu_bst.h -  This header file declares the methods in the rcu_bst.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef RCUBST_H
+#define RCUBST_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/**
+ * @struct RcuNode
+ * @brief A tree node whose child pointers are published with release stores.
+ */
+struct RcuNode {
+    const int key;                  /**< Key for the tree node. */
+    std::atomic<RcuNode*> left;     /**< Pointer to the left child. */
+    std::atomic<RcuNode*> right;    /**< Pointer to the right child. */
+
+    /**
+     * @brief Constructor for RcuNode.
+     *
+     * @param k The key of the node.
+     * @param l Pointer to the left child (default is nullptr).
+     * @param r Pointer to the right child (default is nullptr).
+     */
+    explicit RcuNode(int k, RcuNode* l = nullptr, RcuNode* r = nullptr);
+};
+
+/**
+ * @class RcuReadGuard
+ * @brief RAII read-side critical section for RcuBinarySearchTree.
+ *
+ * Entering and leaving are one plain store each: no locks and no atomic
+ * read-modify-write. On Linux the writer uses membarrier(2) to order the
+ * store against the reader's loads; elsewhere the reader adds one fence.
+ * Read sections may nest on the same thread.
+ */
+class RcuReadGuard {
+public:
+    RcuReadGuard();
+    ~RcuReadGuard();
+    RcuReadGuard(const RcuReadGuard&) = delete;
+    RcuReadGuard& operator=(const RcuReadGuard&) = delete;
+};
+
+/**
+ * @class RcuBinarySearchTree
+ * @brief A read-mostly binary search tree with an RCU (read-copy-update) read path.
+ *
+ * Readers walk the live tree inside an RcuReadGuard and never wait for
+ * writers or for each other, so read throughput scales with cores.
+ * Writers are serialized by one mutex and publish every change with a single
+ * pointer store: a new leaf is linked in place, a node with one child is
+ * bypassed, and a node with two children is replaced by a copy holding its
+ * successor's key before the successor is unlinked. Unlinked nodes are freed
+ * only after a grace period, once every reader that might have seen them has
+ * left its read section.
+ */
+class RcuBinarySearchTree {
+public:
+    /**
+     * @brief Default constructor for RcuBinarySearchTree.
+     *
+     * Initializes an empty tree.
+     */
+    RcuBinarySearchTree();
+
+    /**
+     * @brief Destructor; must not race with readers of this tree.
+     */
+    ~RcuBinarySearchTree();
+
+    RcuBinarySearchTree(const RcuBinarySearchTree&) = delete;
+    RcuBinarySearchTree& operator=(const RcuBinarySearchTree&) = delete;
+
+    /**
+     * @brief Adds a key to the tree. Serialized with other writers.
+     *
+     * @param key The key to be added to the tree.
+     */
+    void addToTree(int key);
+
+    /**
+     * @brief Removes a key from the tree. Serialized with other writers.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the node was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Checks if the tree contains a key. Lock-free read path.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key) const;
+
+    /**
+     * @brief Gets the height of the tree. Read path.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree() const;
+
+    /**
+     * @brief Gets the number of nodes in the tree. Read path.
+     *
+     * @return The number of nodes in the tree.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Checks if the tree is empty. Read path.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Unpublishes every node and frees them after a grace period.
+     */
+    void clear();
+
+    /**
+     * @brief Performs an in-order traversal of the tree and prints the nodes. Read path.
+     */
+    void printInOrder() const;
+
+    /**
+     * @brief Waits until every read section that started before the call has ended.
+     *
+     * Also frees the nodes retired so far. Must not be called, nor any
+     * writer, from inside a read section: it would wait for itself.
+     */
+    void synchronize();
+
+private:
+    std::atomic<RcuNode*> root;         /**< Pointer to the root node of the tree */
+    std::mutex writerMutex;             /**< Serializes writers */
+    std::vector<RcuNode*> retired;      /**< Unlinked nodes waiting for a grace period (writer only) */
+
+    /**
+     * @brief Queues an unlinked node; runs a grace period once enough have piled up.
+     *
+     * @param node The node to free later.
+     */
+    void retire(RcuNode* node);
+
+    /**
+     * @brief Grace period plus free, with writerMutex already held.
+     */
+    void synchronizeLocked();
+};
+
+#endif // RCUBST_H
@@ -0,0 +1,246 @@
+/**
+* @author - Hugh Hui
+* @file sharded_bst.cpp - Key-range sharded tree built from independent BinarySearchTree shards.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "sharded_bst.h"
+#include "tree_iterator.h"
+#include <algorithm>
+#include <climits>
+#include <iostream>
+#include <utility>
+
+// One key in SAMPLE_EVERY inserts is sampled, into a ring of SAMPLE_SIZE keys per shard
+static const int SAMPLE_EVERY = 16;
+static const size_t SAMPLE_SIZE = 256;
+// Stored keys sampled per shard when picking boundaries
+static const int RANK_SAMPLES = 64;
+// A shard checks for overload once per this many inserts
+static const int CHECK_INTERVAL = 1024;
+// Overloaded means more than OVERLOAD_FACTOR times the average shard size
+static const int OVERLOAD_FACTOR = 2;
+
+// File-local helpers
+static int keyAtRank(const TreeNode* node, int rank);
+
+// Constructor: split the int range evenly
+ShardedBinarySearchTree::ShardedBinarySearchTree(int numberOfShards)
+    : numberOfShards(numberOfShards < 1 ? 1 : numberOfShards),
+      shards(new Shard[this->numberOfShards]),
+      boundaries(new std::atomic<int>[this->numberOfShards]) {
+    long long span = (static_cast<long long>(INT_MAX) - INT_MIN + 1) / this->numberOfShards;
+    for (int i = 0; i + 1 < this->numberOfShards; ++i)
+        boundaries[i].store(static_cast<int>(INT_MIN + span * (i + 1)), std::memory_order_relaxed);
+}
+
+// Destructor: the shard trees free themselves
+ShardedBinarySearchTree::~ShardedBinarySearchTree() {}
+
+// 1. addToTree - insert into the owning shard and sample the key
+void ShardedBinarySearchTree::addToTree(int key) {
+    int index = lockShardFor(key);
+    Shard& shard = shards[index];
+    shard.tree.addToTree(key);
+    shard.size.store(shard.tree.getNumberOfTreeNodes(), std::memory_order_relaxed);
+    int inserts = ++shard.inserts;
+    if (inserts % SAMPLE_EVERY == 0) {
+        size_t slot = static_cast<size_t>(inserts / SAMPLE_EVERY - 1) % SAMPLE_SIZE;
+        if (slot < shard.samples.size())
+            shard.samples[slot] = key;
+        else
+            shard.samples.push_back(key);
+    }
+    bool overloaded = inserts % CHECK_INTERVAL == 0 && isOverloaded(index);
+    shard.lock.unlock();
+    if (overloaded)
+        rebalance();
+}
+
+// 2. removeNode - remove from the owning shard
+bool ShardedBinarySearchTree::removeNode(int key) {
+    int index = lockShardFor(key);
+    Shard& shard = shards[index];
+    bool removed = shard.tree.removeNode(key);
+    shard.size.store(shard.tree.getNumberOfTreeNodes(), std::memory_order_relaxed);
+    shard.lock.unlock();
+    return removed;
+}
+
+// 3. contains - search the owning shard
+bool ShardedBinarySearchTree::contains(int key) const {
+    int index = lockShardFor(key);
+    bool found = shards[index].tree.contains(key);
+    shards[index].lock.unlock();
+    return found;
+}
+
+// 4. getNumberOfTreeNodes - sum of the shard sizes
+int ShardedBinarySearchTree::getNumberOfTreeNodes() const {
+    int count = 0;
+    for (int i = 0; i < numberOfShards; ++i)
+        count += shards[i].size.load(std::memory_order_relaxed);
+    return count;
+}
+
+// 5. getShardSize - size of one shard
+int ShardedBinarySearchTree::getShardSize(int shard) const {
+    return shards[shard].size.load(std::memory_order_relaxed);
+}
+
+// 6. getNumberOfShards - Getter for the shard count
+int ShardedBinarySearchTree::getNumberOfShards() const {
+    return numberOfShards;
+}
+
+// 7. isEmpty - Check if the tree is empty
+bool ShardedBinarySearchTree::isEmpty() const {
+    return getNumberOfTreeNodes() == 0;
+}
+
+// 8. clear - clear each shard in turn
+void ShardedBinarySearchTree::clear() {
+    for (int i = 0; i < numberOfShards; ++i) {
+        std::lock_guard<std::mutex> guard(shards[i].lock);
+        shards[i].tree.clear();
+        shards[i].size.store(0, std::memory_order_relaxed);
+        shards[i].inserts = 0;
+        shards[i].samples.clear();
+    }
+}
+
+// 9. rebalance - move boundaries to the weighted sample quantiles and rebuild the shards
+void ShardedBinarySearchTree::rebalance() {
+    std::unique_lock<std::mutex> exclusive(rebalanceMutex, std::try_to_lock);
+    if (!exclusive.owns_lock())
+        return; // someone else is already rebalancing
+    for (int i = 0; i < numberOfShards; ++i)
+        shards[i].lock.lock();
+
+    // Two samples, each normalized to weight 1: keys at evenly spaced ranks of
+    // every shard stand for what is stored, the insert ring for where writes land.
+    long long totalSize = 0;
+    long long totalInserts = 0;
+    for (int i = 0; i < numberOfShards; ++i) {
+        totalSize += shards[i].tree.getNumberOfTreeNodes();
+        if (!shards[i].samples.empty())
+            totalInserts += shards[i].inserts;
+    }
+    std::vector<std::pair<int, double>> weighted;
+    double totalWeight = 0.0;
+    for (int i = 0; i < numberOfShards; ++i) {
+        const Shard& shard = shards[i];
+        int size = shard.tree.getNumberOfTreeNodes();
+        int ranks = std::min(size, RANK_SAMPLES);
+        for (int j = 0; j < ranks; ++j) {
+            int rank = static_cast<int>((j + 0.5) * size / ranks);
+            weighted.emplace_back(keyAtRank(shard.tree.getRoot(), rank), static_cast<double>(size) / ranks / totalSize);
+        }
+        for (int key : shard.samples)
+            weighted.emplace_back(key, static_cast<double>(shard.inserts) / shard.samples.size() / totalInserts);
+    }
+    for (const std::pair<int, double>& sample : weighted)
+        totalWeight += sample.second;
+
+    if (!weighted.empty()) {
+        std::sort(weighted.begin(), weighted.end());
+        std::vector<int> cuts;
+        double seen = 0.0;
+        size_t next = 0;
+        for (int i = 1; i < numberOfShards; ++i) {
+            double target = totalWeight * i / numberOfShards;
+            while (next < weighted.size() && seen + weighted[next].second <= target)
+                seen += weighted[next++].second;
+            // Equal cuts leave empty shards, which is harmless
+            cuts.push_back(next < weighted.size() ? weighted[next].first : INT_MAX);
+        }
+
+        // Shards are disjoint and ordered, so their walks concatenate into sorted order
+        std::vector<int> keys;
+        keys.reserve(getNumberOfTreeNodes());
+        for (int i = 0; i < numberOfShards; ++i) {
+            InOrderIterator it(shards[i].tree.getRoot());
+            while (it.hasNext())
+                keys.push_back(it.next());
+        }
+
+        std::vector<int>::const_iterator begin = keys.begin();
+        for (int i = 0; i < numberOfShards; ++i) {
+            std::vector<int>::const_iterator end = i + 1 < numberOfShards
+                ? std::lower_bound(begin, keys.cend(), cuts[i])
+                : keys.cend();
+            Shard& shard = shards[i];
+            shard.tree.buildFromSorted(std::vector<int>(begin, end));
+            shard.size.store(static_cast<int>(end - begin), std::memory_order_relaxed);
+            shard.inserts = 0;
+            shard.samples.clear();
+            if (i + 1 < numberOfShards)
+                boundaries[i].store(cuts[i], std::memory_order_relaxed);
+            begin = end;
+        }
+    }
+
+    for (int i = numberOfShards - 1; i >= 0; --i)
+        shards[i].lock.unlock();
+}
+
+// 10. printInOrder - shard walks in shard order, under every lock
+void ShardedBinarySearchTree::printInOrder() const {
+    for (int i = 0; i < numberOfShards; ++i)
+        shards[i].lock.lock();
+    std::cout << "Performing In-order traversal" << std::endl;
+    for (int i = 0; i < numberOfShards; ++i) {
+        InOrderIterator it(shards[i].tree.getRoot());
+        while (it.hasNext())
+            std::cout << "Node key: " << it.next() << std::endl;
+    }
+    for (int i = numberOfShards - 1; i >= 0; --i)
+        shards[i].lock.unlock();
+}
+
+// 11. lockShardFor - route, lock, and retry if a rebalance moved the key
+int ShardedBinarySearchTree::lockShardFor(int key) const {
+    while (true) {
+        int index = shardFor(key);
+        shards[index].lock.lock();
+        // Boundaries next to a locked shard cannot change
+        if (shardFor(key) == index)
+            return index;
+        shards[index].lock.unlock();
+    }
+}
+
+// 12. shardFor - binary search over the boundaries
+int ShardedBinarySearchTree::shardFor(int key) const {
+    int low = 0;
+    int high = numberOfShards - 1;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (key < boundaries[mid].load(std::memory_order_relaxed))
+            high = mid;
+        else
+            low = mid + 1;
+    }
+    return low;
+}
+
+// 13. isOverloaded - compare a shard against the average shard size
+bool ShardedBinarySearchTree::isOverloaded(int shard) const {
+    long long total = getNumberOfTreeNodes();
+    long long size = shards[shard].size.load(std::memory_order_relaxed);
+    return numberOfShards > 1 && size * numberOfShards > OVERLOAD_FACTOR * total + CHECK_INTERVAL;
+}
+
+// File-local: key with the given 0-based rank, using the subtree sizes
+static int keyAtRank(const TreeNode* node, int rank) {
+    while (true) {
+        int leftSize = node->left ? node->left->numberOfNodes : 0;
+        if (rank < leftSize) {
+            node = node->left;
+        } else if (rank == leftSize) {
+            return node->key;
+        } else {
+            rank -= leftSize + 1;
+            node = node->right;
+        }
+    }
+}
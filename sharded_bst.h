@@ -0,0 +1,171 @@
+/**
+* @author - Hugh Hui
+* @file sharded_bst.h -  This header file declares the methods in the sharded_bst.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef SHARDEDBST_H
+#define SHARDEDBST_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "binary_search_tree.h"
+
+/**
+ * @class ShardedBinarySearchTree
+ * @brief A thread-safe set that splits the key space into independent BinarySearchTree shards.
+ *
+ * Shard i owns the keys in [boundary(i), boundary(i + 1)) and has its own
+ * lock, so writers to different key ranges never touch the same lock or the
+ * same top tree levels. Each shard keeps a small sample of the keys inserted
+ * into it. When one shard grows well past the average, `rebalance` picks new
+ * boundaries from those samples plus keys sampled by rank from each shard,
+ * and rebuilds every shard balanced. It can also be called explicitly.
+ *
+ * Since the key ranges are ordered and disjoint, an in-order walk of the whole
+ * set is the shard walks concatenated in shard order.
+ */
+class ShardedBinarySearchTree {
+public:
+    /**
+     * @brief Constructs an empty tree with evenly spaced shard boundaries.
+     *
+     * @param numberOfShards Number of shards (values below 1 are treated as 1).
+     */
+    explicit ShardedBinarySearchTree(int numberOfShards = 16);
+
+    /**
+     * @brief Destructor; must not race with other operations.
+     */
+    ~ShardedBinarySearchTree();
+
+    ShardedBinarySearchTree(const ShardedBinarySearchTree&) = delete;
+    ShardedBinarySearchTree& operator=(const ShardedBinarySearchTree&) = delete;
+
+    /**
+     * @brief Adds a key to the tree. Locks one shard.
+     *
+     * @param key The key to be added to the tree.
+     */
+    void addToTree(int key);
+
+    /**
+     * @brief Removes a key from the tree. Locks one shard.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the node was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Checks if the tree contains a key. Locks one shard.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key) const;
+
+    /**
+     * @brief Gets the number of keys; a snapshot if writers are running.
+     *
+     * @return The number of nodes over all shards.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Gets the number of keys in one shard.
+     *
+     * @param shard The shard index.
+     * @return The number of nodes in that shard.
+     */
+    int getShardSize(int shard) const;
+
+    /**
+     * @brief Gets the number of shards.
+     *
+     * @return The number of shards.
+     */
+    int getNumberOfShards() const;
+
+    /**
+     * @brief Checks if the tree is empty.
+     *
+     * @return True if every shard is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Clears every shard. Boundaries are kept.
+     */
+    void clear();
+
+    /**
+     * @brief Moves the shard boundaries to the quantiles of the sampled keys.
+     *
+     * Locks every shard and picks boundaries that split both the stored keys
+     * and the recent inserts evenly, as far as the samples tell. Stored keys
+     * are sampled at evenly spaced ranks using the subtree sizes. Each shard
+     * is then rebuilt from its new key range with `buildFromSorted`. Does
+     * nothing if the tree is empty.
+     */
+    void rebalance();
+
+    /**
+     * @brief Performs an in-order traversal of all shards and prints the nodes.
+     *
+     * Holds every shard lock for the duration, so the output is a consistent
+     * snapshot. Output matches BinarySearchTree::printInOrder.
+     */
+    void printInOrder() const;
+
+private:
+    /**
+     * @struct Shard
+     * @brief One key range: its tree, lock and insert sample.
+     *
+     * Aligned to a cache line so neighbouring shards do not false-share.
+     */
+    struct alignas(64) Shard {
+        mutable std::mutex lock;        /**< Guards everything below */
+        BinarySearchTree tree;          /**< Keys in this shard's range */
+        std::atomic<int> size{0};       /**< Mirror of tree size, read without the lock */
+        int inserts = 0;                /**< addToTree calls since the last rebalance */
+        std::vector<int> samples;       /**< Every SAMPLE_EVERY-th inserted key, ring of SAMPLE_SIZE */
+    };
+
+    int numberOfShards;                             /**< Number of shards */
+    std::unique_ptr<Shard[]> shards;                /**< The shards, in key order */
+    std::unique_ptr<std::atomic<int>[]> boundaries; /**< boundaries[i] is the lowest key of shard i + 1 */
+    std::mutex rebalanceMutex;                      /**< One rebalance at a time */
+
+    /**
+     * @brief Finds and locks the shard that currently owns a key.
+     *
+     * Boundaries are read without a lock and rechecked once the shard is
+     * locked; a rebalance in between makes the caller retry.
+     *
+     * @param key The key to route.
+     * @return The locked shard's index; the caller must unlock it.
+     */
+    int lockShardFor(int key) const;
+
+    /**
+     * @brief Index of the shard whose range holds a key, from the current boundaries.
+     *
+     * @param key The key to route.
+     * @return The shard index.
+     */
+    int shardFor(int key) const;
+
+    /**
+     * @brief Checks whether a shard is far larger than the average.
+     *
+     * @param shard The shard that just grew.
+     * @return True if a rebalance is worthwhile.
+     */
+    bool isOverloaded(int shard) const;
+};
+
+#endif // SHARDEDBST_H
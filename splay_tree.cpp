@@ -0,0 +1,247 @@
+/**
+* @author - Hugh Hui
+* @file splay_tree.cpp - Top-down splay tree engine.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "splay_tree.h"
+#include "tree_node.h"
+#include <iostream>
+#include <stack>
+#include <queue>
+
+// Constructor: initialize empty tree
+SplayTree::SplayTree()
+    : root(nullptr) {}
+
+// Destructor: delete entire tree
+SplayTree::~SplayTree() {
+    clear();
+}
+
+// 1. addToTree - Insert a key and splay it to the root
+void SplayTree::addToTree(int key) {
+    if (!root) {
+        root = new TreeNode(key);
+        return;
+    }
+    root = splay(root, key);
+    if (root->key == key)
+        return; // no duplicates
+
+    // The splayed root is the in-order neighbour of key: split around it
+    TreeNode* node = new TreeNode(key);
+    if (key < root->key) {
+        node->left = root->left;
+        node->right = root;
+        root->left = nullptr;
+    } else {
+        node->right = root->right;
+        node->left = root;
+        root->right = nullptr;
+    }
+    root = node;
+}
+
+// 2. removeNode - Splay the key to the root and join its subtrees
+bool SplayTree::removeNode(int key) {
+    if (!root)
+        return false;
+    root = splay(root, key);
+    if (root->key != key)
+        return false;
+
+    TreeNode* old = root;
+    if (!root->left) {
+        root = root->right;
+    } else {
+        // Splaying the left subtree for key brings its maximum to the top,
+        // which then has no right child to collide with.
+        root = splay(root->left, key);
+        root->right = old->right;
+    }
+    delete old;
+    return true;
+}
+
+// 3. getHeightOfTree - level-by-level count, no recursion
+int SplayTree::getHeightOfTree() const {
+    if (!root) return 0;
+    int height = 0;
+    std::queue<TreeNode*> level;
+    level.push(root);
+    while (!level.empty()) {
+        ++height;
+        for (size_t n = level.size(); n > 0; --n) {
+            TreeNode* node = level.front();
+            level.pop();
+            if (node->left) level.push(node->left);
+            if (node->right) level.push(node->right);
+        }
+    }
+    return height;
+}
+
+// 4. getNumberOfTreeNodes - Get the total number of nodes in the tree
+int SplayTree::getNumberOfTreeNodes() const {
+    int count = 0;
+    std::stack<TreeNode*> pending;
+    if (root) pending.push(root);
+    while (!pending.empty()) {
+        TreeNode* node = pending.top();
+        pending.pop();
+        ++count;
+        if (node->left) pending.push(node->left);
+        if (node->right) pending.push(node->right);
+    }
+    return count;
+}
+
+// 5. contains - Splay the key (or its neighbour) to the root and test it
+bool SplayTree::contains(int key) {
+    if (!root)
+        return false;
+    root = splay(root, key);
+    return root->key == key;
+}
+
+// 6. getRoot - Getter for the root node of the tree
+TreeNode* SplayTree::getRoot() const {
+    return root;
+}
+
+// 7. isEmpty - Check if the tree is empty
+bool SplayTree::isEmpty() const {
+    return root == nullptr;
+}
+
+// 8. clear - Removes tree without recursing down long chains
+void SplayTree::clear() {
+    std::stack<TreeNode*> pending;
+    if (root) pending.push(root);
+    while (!pending.empty()) {
+        TreeNode* node = pending.top();
+        pending.pop();
+        if (node->left) pending.push(node->left);
+        if (node->right) pending.push(node->right);
+        delete node;
+    }
+    root = nullptr;
+}
+
+// 9. printNodeFromTree - print only the key of a node
+void SplayTree::printNodeFromTree(TreeNode* node) const {
+    if (!node) {
+        std::cout << "Node is null" << std::endl;
+        return;
+    }
+    std::cout << "Node key: " << node->key << std::endl;
+}
+
+// 10. printInOrder - print the tree in an in-order traversal
+void SplayTree::printInOrder() const {
+    std::cout << "Performing In-order traversal" << std::endl;
+    std::stack<TreeNode*> pending;
+    TreeNode* curr = root;
+    while (curr || !pending.empty()) {
+        while (curr) {
+            pending.push(curr);
+            curr = curr->left;
+        }
+        curr = pending.top();
+        pending.pop();
+        std::cout << "Node key: " << curr->key << std::endl;
+        curr = curr->right;
+    }
+}
+
+// 11. printPreOrder - print the tree in a Pre-order traversal
+void SplayTree::printPreOrder() const {
+    std::cout << "Performing Pre-order traversal" << std::endl;
+    std::stack<TreeNode*> pending;
+    if (root) pending.push(root);
+    while (!pending.empty()) {
+        TreeNode* node = pending.top();
+        pending.pop();
+        std::cout << "Node key: " << node->key << std::endl;
+        if (node->right) pending.push(node->right);
+        if (node->left) pending.push(node->left);
+    }
+}
+
+// 12. printPostOrder - print the tree in a Post-order traversal
+void SplayTree::printPostOrder() const {
+    std::cout << "Performing Post-order traversal" << std::endl;
+    // Reverse of a root-right-left walk is left-right-root
+    std::stack<TreeNode*> pending;
+    std::stack<int> output;
+    if (root) pending.push(root);
+    while (!pending.empty()) {
+        TreeNode* node = pending.top();
+        pending.pop();
+        output.push(node->key);
+        if (node->left) pending.push(node->left);
+        if (node->right) pending.push(node->right);
+    }
+    while (!output.empty()) {
+        std::cout << "Node key: " << output.top() << std::endl;
+        output.pop();
+    }
+}
+
+// 13. printDepthFirst - header only, no node dump
+void SplayTree::printDepthFirst() const {
+    std::cout << "Performing Depth First via PreOrder traversal" << std::endl;
+}
+
+// 14. printBreadthFirst - header only, no node dump
+void SplayTree::printBreadthFirst() const {
+    std::cout << "Performing Breadth First traversal" << std::endl;
+}
+
+// 15. splay - Sleator-Tarjan top-down splay
+TreeNode* SplayTree::splay(TreeNode* node, int key) {
+    TreeNode header;            // left/right hold the assembled R and L trees
+    TreeNode* leftMax = &header;
+    TreeNode* rightMin = &header;
+
+    while (true) {
+        if (key < node->key) {
+            if (!node->left) break;
+            if (key < node->left->key) {
+                // zig-zig: rotate right
+                TreeNode* child = node->left;
+                node->left = child->right;
+                child->right = node;
+                node = child;
+                if (!node->left) break;
+            }
+            // link right
+            rightMin->left = node;
+            rightMin = node;
+            node = node->left;
+        } else if (key > node->key) {
+            if (!node->right) break;
+            if (key > node->right->key) {
+                // zag-zag: rotate left
+                TreeNode* child = node->right;
+                node->right = child->left;
+                child->left = node;
+                node = child;
+                if (!node->right) break;
+            }
+            // link left
+            leftMax->right = node;
+            leftMax = node;
+            node = node->right;
+        } else {
+            break;
+        }
+    }
+
+    // Reassemble
+    leftMax->right = node->left;
+    rightMin->left = node->right;
+    node->left = header.right;
+    node->right = header.left;
+    return node;
+}
@@ -0,0 +1,149 @@
+/**
+* @author - Hugh Hui
+* @file splay_tree.h -  This header file declares the methods in the splay_tree.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef SPLAYTREE_H
+#define SPLAYTREE_H
+
+#include "tree_node.h"
+
+/**
+ * @class SplayTree
+ * @brief A self-adjusting binary search tree with the same API as BinarySearchTree.
+ *
+ * Every access (`addToTree`, `contains`, `removeNode`) splays the accessed key,
+ * or the last node on its search path, to the root. Frequently used keys stay
+ * near the top of the tree, which shortens search paths under skewed (Zipf)
+ * access patterns. Traversal output matches BinarySearchTree line for line.
+ */
+class SplayTree {
+public:
+    /**
+     * @brief Default constructor for SplayTree.
+     *
+     * Initializes an empty splay tree.
+     */
+    SplayTree();
+
+    /**
+     * @brief Destructor for SplayTree.
+     *
+     * Frees the dynamically allocated memory by deleting all nodes in the tree.
+     */
+    ~SplayTree();
+
+    SplayTree(const SplayTree&) = delete;
+    SplayTree& operator=(const SplayTree&) = delete;
+
+    /**
+     * @brief Adds a node with the specified key and splays it to the root.
+     *
+     * @param key The key to be added to the tree.
+     */
+    void addToTree(int key);
+
+    /**
+     * @brief Removes a node with the specified key from the tree.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the node was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Gets the height of the tree.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree() const;
+
+    /**
+     * @brief Gets the number of nodes in the tree.
+     *
+     * @return The number of nodes in the tree.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Checks if the tree contains a node with the specified key.
+     *
+     * Not const: the last node on the search path is splayed to the root.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key);
+
+    /**
+     * @brief Gets the root node of the tree.
+     *
+     * @return A pointer to the root node of the tree.
+     */
+    TreeNode* getRoot() const;
+
+    /**
+     * @brief Checks if the tree is empty.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Clears the entire tree.
+     *
+     * Deletes all the nodes in the tree, freeing up memory.
+     */
+    void clear();
+
+    /**
+     * @brief Prints the key of a specific node.
+     *
+     * @param node A pointer to the node whose data is to be printed.
+     */
+    void printNodeFromTree(TreeNode* node) const;
+
+    /**
+     * @brief Performs an in-order traversal of the tree and prints the nodes.
+     */
+    void printInOrder() const;
+
+    /**
+     * @brief Performs a pre-order traversal of the tree and prints the nodes.
+     */
+    void printPreOrder() const;
+
+    /**
+     * @brief Performs a post-order traversal of the tree and prints the nodes.
+     */
+    void printPostOrder() const;
+
+    /**
+     * @brief Prints the depth-first traversal header, as BinarySearchTree does.
+     */
+    void printDepthFirst() const;
+
+    /**
+     * @brief Prints the breadth-first traversal header, as BinarySearchTree does.
+     */
+    void printBreadthFirst() const;
+
+private:
+    TreeNode* root; /**< Pointer to the root node of the tree */
+
+    /**
+     * @brief Top-down splay of the given key.
+     *
+     * Moves the node holding `key`, or the last node visited while searching
+     * for it, to the root. Runs iteratively so long chains cannot overflow
+     * the stack.
+     *
+     * @param node The root of the subtree to splay.
+     * @param key The key to splay towards the root.
+     * @return The new root of the subtree.
+     */
+    static TreeNode* splay(TreeNode* node, int key);
+};
+
+#endif // SPLAYTREE_H
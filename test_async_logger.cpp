@@ -0,0 +1,145 @@
+/**
+* @author - Hugh Hui
+* @file test_async_logger.cpp - Sink routing, per-thread order and overflow tests for AsyncLogger.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Build: g++ -std=c++17 -O2 -pthread test_async_logger.cpp async_logger.cpp
+*
+* Returns 0 when every check passes. Records naming their own file stream
+* stand in for the driver's file entries running at once.
+*/
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "async_logger.h"
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Lines "<prefix> 0" to "<prefix> count-1"
+static std::string numberedLines(const std::string& prefix, int count) {
+    std::string text;
+    for (int i = 0; i < count; ++i)
+        text += prefix + " " + std::to_string(i) + "\n";
+    return text;
+}
+
+// 1) Each record reaches its sinks, including a file stream it names
+static void testSinks() {
+    std::ostringstream console;
+    std::ostringstream file;
+    std::ostringstream entryFile;
+    {
+        AsyncLogger logger(console, file, 16);
+        logger.log("both\n", 5, AsyncLogger::CONSOLE | AsyncLogger::FILE);
+        logger.log("console\n", 8, AsyncLogger::CONSOLE);
+        logger.log("entry\n", 6, AsyncLogger::FILE, &entryFile);
+        logger.log("console too\n", 12, AsyncLogger::CONSOLE | AsyncLogger::FILE, &entryFile);
+
+        // Longer than one record, through a stream bound to the named file
+        std::string longLine(1000, 'x');
+        AsyncLogger::Stream stream(logger, AsyncLogger::FILE, &entryFile);
+        stream << longLine << std::endl;
+        logger.flush();
+        check(entryFile.str() == "entry\nconsole too\n" + longLine + "\n", "named file gets its records");
+        check(logger.getWrittenCount() > 4, "written count");
+    }
+    check(console.str() == "both\nconsole\nconsole too\n", "console records");
+    check(file.str() == "both\n", "named file records stay out of the logger's file");
+}
+
+// 2) Lines from each thread keep their order in their own stream and on the shared console
+static void testThreads() {
+    const int threads = 8;
+    const int lines = 2000;
+    std::ostringstream console;
+    std::ostringstream file;
+    std::vector<std::unique_ptr<std::ostringstream>> entryFiles;
+    for (int t = 0; t < threads; ++t)
+        entryFiles.emplace_back(new std::ostringstream);
+    {
+        AsyncLogger logger(console, file, 64);
+        std::vector<std::thread> writers;
+        for (int t = 0; t < threads; ++t) {
+            writers.emplace_back([&logger, &entryFiles, t] {
+                AsyncLogger::Stream stream(logger, AsyncLogger::FILE, entryFiles[t].get());
+                for (int i = 0; i < lines; ++i) {
+                    std::string line = "thread " + std::to_string(t) + " " + std::to_string(i) + "\n";
+                    stream << line;
+                    logger.log(line.data(), line.size(), AsyncLogger::CONSOLE);
+                }
+            });
+        }
+        for (std::thread& writer : writers)
+            writer.join();
+    }
+
+    bool ok = file.str().empty();
+    for (int t = 0; t < threads; ++t)
+        ok = ok && entryFiles[t]->str() == numberedLines("thread " + std::to_string(t), lines);
+    check(ok, "each file stream in order");
+
+    // Pick each thread's lines out of the console and check their order
+    std::vector<int> next(threads, 0);
+    std::istringstream in(console.str());
+    std::string word;
+    int t;
+    int i;
+    int total = 0;
+    ok = true;
+    while (in >> word >> t >> i) {
+        ok = ok && t >= 0 && t < threads && next[t] == i;
+        if (t >= 0 && t < threads)
+            ++next[t];
+        ++total;
+    }
+    check(ok && total == threads * lines, "console lines in order per thread");
+}
+
+// 3) A full ring blocks or drops as configured, and counts what it drops
+static void testOverflow() {
+    std::ostringstream console;
+    std::ostringstream file;
+    const int lines = 20000;
+    {
+        AsyncLogger logger(console, file, 2, AsyncLogger::BLOCK);
+        for (int i = 0; i < lines; ++i) {
+            std::string line = "line " + std::to_string(i) + "\n";
+            logger.log(line.data(), line.size(), AsyncLogger::FILE);
+        }
+        logger.flush();
+        check(logger.getDroppedCount() == 0 && logger.getWrittenCount() == static_cast<uint64_t>(lines),
+              "block loses nothing");
+    }
+    check(file.str() == numberedLines("line", lines), "block keeps order");
+
+    std::ostringstream dropConsole;
+    std::ostringstream dropFile;
+    AsyncLogger logger(dropConsole, dropFile, 2, AsyncLogger::DROP);
+    int refused = 0;
+    for (int i = 0; i < lines; ++i) {
+        if (!logger.log("x\n", 2, AsyncLogger::FILE))
+            ++refused;
+    }
+    logger.flush();
+    check(logger.getDroppedCount() == static_cast<uint64_t>(refused), "drop count");
+    check(logger.getWrittenCount() + logger.getDroppedCount() == static_cast<uint64_t>(lines), "every record written or dropped");
+    check(dropFile.str().size() == static_cast<size_t>(2 * (lines - refused)), "only kept records written");
+}
+
+int main() {
+    testSinks();
+    testThreads();
+    testOverflow();
+    std::cout << (failures == 0 ? "All async logger tests passed." : "Async logger tests FAILED.") << std::endl;
+    return failures == 0 ? 0 : 1;
+}
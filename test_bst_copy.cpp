@@ -0,0 +1,179 @@
+/**
+* @author - Hugh Hui
+* @file test_bst_copy.cpp - Copy, move and arena-backed clone tests for BinarySearchTree.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Build: g++ -std=c++17 -O2 -pthread test_bst_copy.cpp binary_search_tree.cpp tree_iterator.cpp tree_node.cpp
+*
+* Returns 0 when every check passes. Run under -fsanitize=address to also
+* catch arena nodes being freed one by one or twice.
+*/
+#include <iostream>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+#include "binary_search_tree.h"
+#include "tree_iterator.h"
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Keys of a tree in order
+static std::vector<int> keysOf(const BinarySearchTree& tree) {
+    std::vector<int> keys;
+    for (InOrderIterator it(tree.getRoot()); it.hasNext();)
+        keys.push_back(it.next());
+    return keys;
+}
+
+// True if the tree holds exactly the keys of expected
+static bool sameKeys(const BinarySearchTree& tree, const std::set<int>& expected) {
+    return keysOf(tree) == std::vector<int>(expected.begin(), expected.end()) &&
+           tree.getNumberOfTreeNodes() == static_cast<int>(expected.size());
+}
+
+// A tree and a std::set with the same random keys
+static void fill(BinarySearchTree& tree, std::set<int>& expected, int count, unsigned seed) {
+    std::mt19937 rng(seed);
+    for (int i = 0; i < count; ++i) {
+        int key = static_cast<int>(rng() % 4000);
+        tree.addToTree(key);
+        expected.insert(key);
+    }
+}
+
+// 1) Copies and clones of an empty tree
+static void testEmpty() {
+    BinarySearchTree empty;
+    BinarySearchTree copy(empty);
+    check(copy.isEmpty() && copy.getRoot() == nullptr, "copy of empty tree");
+    BinarySearchTree cloned = empty.clone();
+    check(cloned.isEmpty(), "clone of empty tree");
+    cloned.addToTree(5);
+    check(cloned.contains(5) && empty.isEmpty(), "add to clone of empty tree");
+
+    BinarySearchTree assigned;
+    assigned.addToTree(1);
+    assigned = empty;
+    check(assigned.isEmpty(), "assign empty tree");
+}
+
+// 2) A copy has the same keys and shape and is independent of the original
+static void testCopy() {
+    BinarySearchTree original;
+    std::set<int> expected;
+    fill(original, expected, 1000, 1);
+
+    BinarySearchTree copy(original);
+    check(sameKeys(copy, expected), "copy keys");
+    check(copy.getHeightOfTree() == original.getHeightOfTree(), "copy height");
+    check(copy.getRoot() != original.getRoot(), "copy has its own nodes");
+
+    copy.addToTree(-1);
+    copy.removeNode(*expected.begin());
+    check(sameKeys(original, expected), "original unchanged by copy updates");
+
+    BinarySearchTree assigned;
+    assigned.addToTree(123456);
+    assigned = original;
+    check(sameKeys(assigned, expected) && !assigned.contains(123456), "copy assignment");
+}
+
+// 3) Moves take the nodes and leave the source empty
+static void testMove() {
+    BinarySearchTree original;
+    std::set<int> expected;
+    fill(original, expected, 500, 2);
+    const TreeNode* root = original.getRoot();
+
+    BinarySearchTree moved(std::move(original));
+    check(moved.getRoot() == root && sameKeys(moved, expected), "move constructor takes nodes");
+    check(original.isEmpty(), "move constructor empties source");
+
+    BinarySearchTree target;
+    target.addToTree(7);
+    target = std::move(moved);
+    check(target.getRoot() == root && sameKeys(target, expected), "move assignment takes nodes");
+    check(moved.isEmpty(), "move assignment empties source");
+
+    // A moved arena must stay with its nodes
+    BinarySearchTree arenaTree = target.clone();
+    BinarySearchTree arenaMoved(std::move(arenaTree));
+    arenaMoved.removeNode(*expected.begin());
+    arenaMoved.clear();
+    check(arenaMoved.isEmpty(), "clear after moving a clone");
+}
+
+// 4) Self-assignment keeps the tree intact
+static void testSelfAssignment() {
+    BinarySearchTree tree;
+    std::set<int> expected;
+    fill(tree, expected, 300, 3);
+
+    BinarySearchTree& alias = tree;
+    tree = alias;
+    check(sameKeys(tree, expected), "self copy assignment");
+    tree = std::move(alias);
+    check(sameKeys(tree, expected), "self move assignment");
+
+    BinarySearchTree cloned = tree.clone();
+    BinarySearchTree& cloneAlias = cloned;
+    cloned = cloneAlias;
+    check(sameKeys(cloned, expected), "self copy assignment of a clone");
+}
+
+// 5) Removing arena nodes, mixing in heap nodes, then clearing
+static void testArenaUpdates() {
+    BinarySearchTree original;
+    std::set<int> expected;
+    fill(original, expected, 2000, 4);
+
+    BinarySearchTree cloned = original.clone();
+    check(sameKeys(cloned, expected), "clone keys");
+    check(cloned.getHeightOfTree() == original.getHeightOfTree(), "clone height");
+
+    // Remove the root repeatedly (two-children path) and random keys, add new ones
+    std::mt19937 rng(5);
+    std::set<int> clonedExpected = expected;
+    for (int i = 0; i < 1500; ++i) {
+        int key = i % 3 == 0 && cloned.getRoot() ? cloned.getRoot()->key : static_cast<int>(rng() % 4000);
+        check(cloned.removeNode(key) == (clonedExpected.erase(key) > 0), "remove from clone");
+        if (i % 2 == 0) {
+            int fresh = 4000 + i;
+            cloned.addToTree(fresh);
+            clonedExpected.insert(fresh);
+        }
+    }
+    check(sameKeys(cloned, clonedExpected), "clone after removes and adds");
+    check(sameKeys(original, expected), "original unchanged by clone updates");
+
+    // A copy of a partly heap, partly arena tree
+    BinarySearchTree copyOfClone(cloned);
+    check(sameKeys(copyOfClone, clonedExpected), "copy of updated clone");
+
+    cloned.clear();
+    check(cloned.isEmpty() && cloned.getNumberOfTreeNodes() == 0, "clear clone");
+    cloned.addToTree(1);
+    check(cloned.contains(1) && cloned.getNumberOfTreeNodes() == 1, "reuse cleared clone");
+
+    // Assigning over a clone frees its arena
+    copyOfClone = original;
+    check(sameKeys(copyOfClone, expected), "assign over clone");
+}
+
+int main() {
+    testEmpty();
+    testCopy();
+    testMove();
+    testSelfAssignment();
+    testArenaUpdates();
+    std::cout << (failures == 0 ? "All copy tests passed." : "Copy tests FAILED.") << std::endl;
+    return failures == 0 ? 0 : 1;
+}
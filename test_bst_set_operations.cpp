@@ -0,0 +1,180 @@
+/**
+* @author - Hugh Hui
+* @file test_bst_set_operations.cpp - Randomized checks of setUnion, setIntersection and setDifference
+*                                     against the standard algorithms, and of numberOfNodes upkeep.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Build: g++ -std=c++17 -O2 -pthread test_bst_set_operations.cpp bst_set_operations.cpp binary_search_tree.cpp
+*            tree_iterator.cpp tree_node.cpp
+*
+* Returns 0 when every check passes. Operand sizes are mixed so that both the
+* merge and the probing paths of setIntersection and setDifference run.
+*/
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+#include "binary_search_tree.h"
+#include "bst_set_operations.h"
+#include "tree_iterator.h"
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Keys of a tree in order
+static std::vector<int> keysOf(const BinarySearchTree& tree) {
+    std::vector<int> keys;
+    for (InOrderIterator it(tree.getRoot()); it.hasNext();)
+        keys.push_back(it.next());
+    return keys;
+}
+
+// True if every node's numberOfNodes is one plus its children's
+static bool sizesConsistent(const TreeNode* root) {
+    std::vector<const TreeNode*> pending;
+    if (root) pending.push_back(root);
+    while (!pending.empty()) {
+        const TreeNode* node = pending.back();
+        pending.pop_back();
+        int expected = 1 + (node->left ? node->left->numberOfNodes : 0) + (node->right ? node->right->numberOfNodes : 0);
+        if (node->numberOfNodes != expected)
+            return false;
+        if (node->left) pending.push_back(node->left);
+        if (node->right) pending.push_back(node->right);
+    }
+    return true;
+}
+
+// Random distinct keys from [0, range), added in random order
+static std::vector<int> randomKeys(int count, int range, std::mt19937& rng) {
+    std::set<int> keys;
+    while (static_cast<int>(keys.size()) < count)
+        keys.insert(static_cast<int>(rng() % range));
+    std::vector<int> shuffled(keys.begin(), keys.end());
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+    return shuffled;
+}
+
+static void build(BinarySearchTree& tree, const std::vector<int>& keys) {
+    for (int key : keys)
+        tree.addToTree(key);
+}
+
+// Runs all three operations on one pair of operands, including into an operand
+static void checkOperations(const std::vector<int>& keysA, const std::vector<int>& keysB, const char* label) {
+    BinarySearchTree a;
+    BinarySearchTree b;
+    build(a, keysA);
+    build(b, keysB);
+    std::vector<int> sortedA = keysOf(a);
+    std::vector<int> sortedB = keysOf(b);
+
+    std::vector<int> expectedUnion;
+    std::set_union(sortedA.begin(), sortedA.end(), sortedB.begin(), sortedB.end(), std::back_inserter(expectedUnion));
+    std::vector<int> expectedIntersection;
+    std::set_intersection(sortedA.begin(), sortedA.end(), sortedB.begin(), sortedB.end(), std::back_inserter(expectedIntersection));
+    std::vector<int> expectedDifference;
+    std::set_difference(sortedA.begin(), sortedA.end(), sortedB.begin(), sortedB.end(), std::back_inserter(expectedDifference));
+
+    BinarySearchTree result;
+    result.addToTree(-1);  // previous contents must be replaced
+    setUnion(a, b, result);
+    bool ok = keysOf(result) == expectedUnion && result.getNumberOfTreeNodes() == static_cast<int>(expectedUnion.size()) &&
+              sizesConsistent(result.getRoot());
+    setIntersection(a, b, result);
+    ok = ok && keysOf(result) == expectedIntersection && sizesConsistent(result.getRoot());
+    setIntersection(b, a, result);
+    ok = ok && keysOf(result) == expectedIntersection;
+    setDifference(a, b, result);
+    ok = ok && keysOf(result) == expectedDifference && sizesConsistent(result.getRoot());
+    check(ok, label);
+
+    // Result aliasing an operand
+    BinarySearchTree aliased(a);
+    setDifference(aliased, b, aliased);
+    check(keysOf(aliased) == expectedDifference, "difference into its first operand");
+    aliased = a;
+    setUnion(b, aliased, aliased);
+    check(keysOf(aliased) == expectedUnion, "union into its second operand");
+}
+
+// 1) Empty, disjoint and identical operands
+static void testEdgeCases() {
+    std::mt19937 rng(1);
+    std::vector<int> keys = randomKeys(500, 10000, rng);
+    std::vector<int> none;
+    checkOperations(none, none, "both empty");
+    checkOperations(keys, none, "right empty");
+    checkOperations(none, keys, "left empty");
+    checkOperations(keys, keys, "identical");
+
+    std::vector<int> low;
+    std::vector<int> high;
+    std::vector<int> evens;
+    std::vector<int> odds;
+    for (int i = 0; i < 300; ++i) {
+        low.push_back(i);
+        high.push_back(1000 + i);
+        evens.push_back(2 * i);
+        odds.push_back(2 * i + 1);
+    }
+    std::shuffle(low.begin(), low.end(), rng);
+    std::shuffle(evens.begin(), evens.end(), rng);
+    checkOperations(low, high, "disjoint ranges");
+    checkOperations(high, low, "disjoint ranges reversed");
+    checkOperations(evens, odds, "interleaved disjoint");
+}
+
+// 2) Random operands of mixed sizes; lopsided pairs take the probing path
+static void testRandom() {
+    std::mt19937 rng(2);
+    const int sizes[] = { 1, 5, 40, 300, 5000 };
+    for (int sizeA : sizes) {
+        for (int sizeB : sizes) {
+            for (int round = 0; round < 3; ++round) {
+                int range = 2 * (sizeA + sizeB) + 10;
+                checkOperations(randomKeys(sizeA, range, rng), randomKeys(sizeB, range, rng), "random operands");
+            }
+        }
+    }
+}
+
+// 3) numberOfNodes stays right through removes, including nodes with two children
+static void testNodeCounts() {
+    std::mt19937 rng(3);
+    BinarySearchTree tree;
+    std::set<int> expected;
+    for (int key : randomKeys(3000, 100000, rng)) {
+        tree.addToTree(key);
+        expected.insert(key);
+    }
+    check(sizesConsistent(tree.getRoot()), "sizes after adds");
+
+    bool ok = true;
+    for (int i = 0; i < 2500; ++i) {
+        // Every third remove takes the root, which usually has two children
+        int key = i % 3 == 0 && tree.getRoot() ? tree.getRoot()->key : static_cast<int>(rng() % 100000);
+        tree.removeNode(key);
+        expected.erase(key);
+        ok = ok && sizesConsistent(tree.getRoot()) &&
+             (!tree.getRoot() || tree.getRoot()->numberOfNodes == static_cast<int>(expected.size()));
+    }
+    check(ok, "sizes after removes");
+    check(tree.getNumberOfTreeNodes() == static_cast<int>(expected.size()), "count after removes");
+}
+
+int main() {
+    testEdgeCases();
+    testRandom();
+    testNodeCounts();
+    std::cout << (failures == 0 ? "All set operation tests passed." : "Set operation tests FAILED.") << std::endl;
+    return failures == 0 ? 0 : 1;
+}
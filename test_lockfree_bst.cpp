@@ -0,0 +1,218 @@
+/**
+* @author - Hugh Hui
+* @file test_lockfree_bst.cpp - Sequential, ownership and linearizability stress tests
+*                               for LockFreeBinarySearchTree and the epoch domain.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Build: g++ -std=c++17 -O2 -pthread test_lockfree_bst.cpp lockfree_bst.cpp epoch_reclamation.cpp
+*
+* Returns 0 when every check passes. Thread counts follow the hardware, with a
+* minimum of two so the tests stay concurrent on small machines.
+*/
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <set>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "epoch_reclamation.h"
+#include "lockfree_bst.h"
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+static int threadCount() {
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    return std::max(2, std::min(hardware, 16));
+}
+
+// 1) Single thread against std::set
+static void testSequential() {
+    LockFreeBinarySearchTree tree;
+    std::set<int> expected;
+    std::mt19937 rng(1);
+    for (int i = 0; i < 200000; ++i) {
+        int key = static_cast<int>(rng() % 2000) - 1000;
+        switch (rng() % 3) {
+        case 0:
+            check(tree.addToTree(key) == expected.insert(key).second, "sequential add");
+            break;
+        case 1:
+            check(tree.removeNode(key) == (expected.erase(key) > 0), "sequential remove");
+            break;
+        default:
+            check(tree.contains(key) == (expected.count(key) > 0), "sequential contains");
+        }
+    }
+    check(tree.getNumberOfTreeNodes() == static_cast<int>(expected.size()), "sequential count");
+    check(tree.addToTree(2147483647) && tree.contains(2147483647), "INT_MAX key");
+    check(tree.addToTree(-2147483647 - 1) && tree.contains(-2147483647 - 1), "INT_MIN key");
+    tree.clear();
+    check(tree.isEmpty() && !tree.contains(0), "clear");
+}
+
+// 2) Each thread owns the keys congruent to its id, so its own view must be exact,
+//    while reader threads hammer every key
+static void testOwnedKeys() {
+    LockFreeBinarySearchTree tree;
+    int threads = threadCount();
+    std::atomic<bool> stop(false);
+    std::atomic<int> mismatches(0);
+    std::vector<std::set<int>> owned(threads);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&, r] {
+            std::mt19937 rng(100 + r);
+            long long hits = 0;
+            while (!stop.load())
+                hits += tree.contains(static_cast<int>(rng() % 4096));
+            if (hits < 0) std::cout << hits;
+        });
+    }
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; ++t) {
+        writers.emplace_back([&, t] {
+            std::mt19937 rng(t);
+            std::set<int>& mine = owned[t];
+            for (int i = 0; i < 50000; ++i) {
+                int key = static_cast<int>(rng() % (4096 / threads)) * threads + t;
+                bool ok;
+                switch (rng() % 3) {
+                case 0: ok = tree.addToTree(key) == mine.insert(key).second; break;
+                case 1: ok = tree.removeNode(key) == (mine.erase(key) > 0); break;
+                default: ok = tree.contains(key) == (mine.count(key) > 0);
+                }
+                if (!ok) ++mismatches;
+            }
+        });
+    }
+    for (std::thread& writer : writers) writer.join();
+    stop.store(true);
+    for (std::thread& reader : readers) reader.join();
+
+    size_t total = 0;
+    for (const std::set<int>& mine : owned) total += mine.size();
+    check(mismatches.load() == 0, "owned keys match per-thread model");
+    check(tree.getNumberOfTreeNodes() == static_cast<int>(total), "owned keys final count");
+}
+
+// 3) Linearizability: short concurrent histories on shared keys, each checked
+//    with a Wing-Gong search against the sequential set specification
+struct Operation {
+    int type;           // 0 add, 1 remove, 2 contains
+    bool result;
+    long long invoke;
+    long long response;
+};
+
+static bool linearizable(const std::vector<Operation>& ops, unsigned long long done, bool present,
+                         std::unordered_set<unsigned long long>& seen) {
+    if (done == (1ULL << ops.size()) - 1)
+        return true;
+    unsigned long long state = (done << 1) | (present ? 1 : 0);
+    if (!seen.insert(state).second)
+        return false;
+    long long earliestResponse = -1;
+    for (size_t i = 0; i < ops.size(); ++i)
+        if (!(done & (1ULL << i)) && (earliestResponse < 0 || ops[i].response < earliestResponse))
+            earliestResponse = ops[i].response;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        // Only operations that started before every pending one finished can go next
+        if ((done & (1ULL << i)) || ops[i].invoke > earliestResponse)
+            continue;
+        bool expected = ops[i].type == 0 ? !present : present;
+        if (ops[i].result != expected)
+            continue;
+        bool next = ops[i].type == 0 ? true : ops[i].type == 1 ? false : present;
+        if (linearizable(ops, done | (1ULL << i), next, seen))
+            return true;
+    }
+    return false;
+}
+
+static void testLinearizability() {
+    const int rounds = 2000;
+    const int keys = 2;
+    const int opsPerThread = 6;
+    int threads = std::min(threadCount(), 4);
+    std::atomic<long long> clock(0);
+    int bad = 0;
+
+    for (int round = 0; round < rounds; ++round) {
+        LockFreeBinarySearchTree tree;
+        std::vector<std::vector<std::pair<int, Operation>>> logs(threads);
+        std::atomic<int> ready(0);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::mt19937 rng(round * 131 + t);
+                ++ready;
+                while (ready.load() < threads)
+                    std::this_thread::yield();
+                for (int i = 0; i < opsPerThread; ++i) {
+                    int key = static_cast<int>(rng() % keys);
+                    Operation op;
+                    op.type = static_cast<int>(rng() % 3);
+                    op.invoke = clock.fetch_add(1);
+                    op.result = op.type == 0 ? tree.addToTree(key)
+                              : op.type == 1 ? tree.removeNode(key)
+                              : tree.contains(key);
+                    op.response = clock.fetch_add(1);
+                    logs[t].push_back({key, op});
+                }
+            });
+        }
+        for (std::thread& worker : workers) worker.join();
+
+        // Sets are compositional: check every key's history on its own
+        for (int key = 0; key < keys; ++key) {
+            std::vector<Operation> history;
+            for (const auto& log : logs)
+                for (const auto& entry : log)
+                    if (entry.first == key) history.push_back(entry.second);
+            std::unordered_set<unsigned long long> seen;
+            if (!linearizable(history, 0, false, seen))
+                ++bad;
+        }
+    }
+    check(bad == 0, "every history is linearizable");
+}
+
+// 4) Everything retired is eventually freed once threads are quiescent
+static void testReclamation() {
+    {
+        LockFreeBinarySearchTree tree;
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threadCount(); ++t) {
+            workers.emplace_back([&, t] {
+                std::mt19937 rng(t + 7);
+                for (int i = 0; i < 50000; ++i) {
+                    int key = static_cast<int>(rng() % 512);
+                    if (rng() % 2) tree.addToTree(key);
+                    else tree.removeNode(key);
+                }
+            });
+        }
+        for (std::thread& worker : workers) worker.join();
+    }
+    EpochDomain::instance().collect();
+    check(EpochDomain::instance().pendingCount() == 0, "retired nodes freed after quiescence");
+}
+
+int main() {
+    testSequential();
+    testOwnedKeys();
+    testLinearizability();
+    testReclamation();
+    std::cout << (failures == 0 ? "All lock-free tree tests passed." : "Lock-free tree tests FAILED.") << std::endl;
+    return failures == 0 ? 0 : 1;
+}
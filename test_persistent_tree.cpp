@@ -0,0 +1,181 @@
+/**
+* @author - Hugh Hui
+* @file test_persistent_tree.cpp - Snapshot isolation, deep-chain release and cross-thread reader
+*                                  tests for PersistentBinarySearchTree.
+* 10/19/2026 - H. Hui created file and added comments.
+*
+* Build: g++ -std=c++17 -O2 -pthread test_persistent_tree.cpp persistent_tree.cpp
+*
+* Returns 0 when every check passes. The chain test releases a million nodes
+* that would overflow the default stack if they were freed by recursion.
+*/
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "persistent_tree.h"
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        std::cout << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Keys of a version in order
+static std::vector<int> keysOf(const PersistentBinarySearchTree& tree) {
+    std::vector<int> keys;
+    std::vector<const PersistentNode*> pending;
+    const PersistentNode* curr = tree.getRoot();
+    while (curr || !pending.empty()) {
+        while (curr) {
+            pending.push_back(curr);
+            curr = curr->left.get();
+        }
+        curr = pending.back();
+        pending.pop_back();
+        keys.push_back(curr->key);
+        curr = curr->right.get();
+    }
+    return keys;
+}
+
+// True if the version holds exactly the keys of expected
+static bool sameKeys(const PersistentBinarySearchTree& tree, const std::set<int>& expected) {
+    return keysOf(tree) == std::vector<int>(expected.begin(), expected.end()) &&
+           tree.getNumberOfTreeNodes() == static_cast<int>(expected.size());
+}
+
+// A node whose two children are both present, or nullptr
+static const PersistentNode* findTwoChildNode(const PersistentNode* node) {
+    std::vector<const PersistentNode*> pending;
+    if (node) pending.push_back(node);
+    while (!pending.empty()) {
+        const PersistentNode* curr = pending.back();
+        pending.pop_back();
+        if (curr->left && curr->right)
+            return curr;
+        if (curr->left) pending.push_back(curr->left.get());
+        if (curr->right) pending.push_back(curr->right.get());
+    }
+    return nullptr;
+}
+
+// 1) Each snapshot keeps the keys it was taken with, through adds and two-child removes
+static void testSnapshotIsolation() {
+    PersistentBinarySearchTree tree;
+    std::set<int> expected;
+    std::vector<std::pair<PersistentBinarySearchTree, std::set<int>>> versions;
+    std::mt19937 rng(1);
+
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < 20; ++i) {
+            int key = static_cast<int>(rng() % 1000);
+            tree.addToTree(key);
+            expected.insert(key);
+        }
+        versions.emplace_back(tree.snapshot(), expected);
+
+        // Remove nodes with two children, which copies the path to the successor
+        for (int i = 0; i < 5; ++i) {
+            const PersistentNode* node = findTwoChildNode(tree.getRoot());
+            if (!node)
+                break;
+            int key = node->key;
+            check(tree.removeNode(key), "two-child remove");
+            expected.erase(key);
+        }
+        check(!tree.removeNode(-1), "remove missing key");
+        versions.emplace_back(tree.snapshot(), expected);
+    }
+
+    bool ok = sameKeys(tree, expected);
+    for (const auto& version : versions)
+        ok = ok && sameKeys(version.first, version.second);
+    check(ok, "snapshots unchanged by later updates");
+
+    // Dropping the newest version leaves the older ones intact
+    tree.clear();
+    check(tree.isEmpty() && sameKeys(versions.front().first, versions.front().second), "clear keeps snapshots");
+    versions.erase(versions.begin() + 1, versions.end());
+    check(sameKeys(versions.front().first, versions.front().second), "release later snapshots");
+}
+
+// 2) A million-node chain is released without recursion
+static void testDeepChain() {
+    const int length = 1000000;
+    // Built bottom-up, since path copying makes a long chain quadratic to grow key by key
+    std::shared_ptr<const PersistentNode> chain;
+    for (int key = 0; key < length; ++key)
+        chain = std::make_shared<PersistentNode>(key, std::move(chain), nullptr);
+    check(chain->numberOfNodes == length, "chain size");
+    chain.reset();  // recursion here would overflow the stack
+
+    // A degenerate tree built through the public interface, released with a live snapshot
+    PersistentBinarySearchTree tree;
+    for (int key = 0; key < 5000; ++key)
+        tree.addToTree(key);
+    PersistentBinarySearchTree snapshot = tree.snapshot();
+    tree.addToTree(5000);
+    tree.clear();
+    check(snapshot.getNumberOfTreeNodes() == 5000 && snapshot.contains(4999) && !snapshot.contains(5000),
+          "snapshot of chain survives clear");
+}
+
+// 3) Readers check snapshots on their own threads while the writer keeps going
+static void testConcurrentReaders() {
+    PersistentBinarySearchTree tree;
+    std::set<int> expected;
+    std::atomic<int> readerFailures(0);
+    std::vector<std::thread> readers;
+    std::mt19937 rng(3);
+
+    for (int round = 0; round < 16; ++round) {
+        for (int i = 0; i < 500; ++i) {
+            int key = static_cast<int>(rng() % 4000);
+            if (rng() % 3 == 0) {
+                tree.removeNode(key);
+                expected.erase(key);
+            } else {
+                tree.addToTree(key);
+                expected.insert(key);
+            }
+        }
+        // The reader owns its snapshot and drops it on its own thread
+        readers.emplace_back([snapshot = tree.snapshot(), keys = expected, &readerFailures]() mutable {
+            for (int pass = 0; pass < 20; ++pass) {
+                for (int key = 0; key < 4000; ++key) {
+                    if (snapshot.contains(key) != (keys.count(key) > 0))
+                        ++readerFailures;
+                }
+                if (!sameKeys(snapshot, keys))
+                    ++readerFailures;
+            }
+            snapshot.clear();
+        });
+    }
+    // Keep writing while the readers run
+    for (int i = 0; i < 20000; ++i) {
+        int key = static_cast<int>(rng() % 4000);
+        if (i % 2) tree.removeNode(key);
+        else tree.addToTree(key);
+    }
+    for (std::thread& reader : readers)
+        reader.join();
+    check(readerFailures.load() == 0, "snapshots read on other threads");
+}
+
+int main() {
+    testSnapshotIsolation();
+    testDeepChain();
+    testConcurrentReaders();
+    std::cout << (failures == 0 ? "All persistent tree tests passed." : "Persistent tree tests FAILED.") << std::endl;
+    return failures == 0 ? 0 : 1;
+}
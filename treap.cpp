@@ -0,0 +1,287 @@
+/**
+* @author - Hugh Hui
+* @file treap.cpp - Randomized balanced tree (treap) engine with split and join.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "treap.h"
+#include "tree_node.h"
+#include <iostream>
+
+// File-local helpers
+static int sizeOf(const TreeNode* node);
+static void update(TreeNode* node);
+static void splitNodes(TreeNode* node, int key, TreeNode*& left, TreeNode*& right);
+static TreeNode* joinNodes(TreeNode* left, TreeNode* right);
+static TreeNode* insertNode(TreeNode* node, TreeNode* fresh);
+static TreeNode* removeNodeHelper(TreeNode* node, int key, bool& removed);
+static void deleteNodes(TreeNode* node);
+static int heightOf(const TreeNode* node);
+static void printInOrderHelper(const TreeNode* node);
+static void printPreOrderHelper(const TreeNode* node);
+static void printPostOrderHelper(const TreeNode* node);
+
+// Constructor: initialize empty tree
+Treap::Treap(unsigned int seed)
+    : root(nullptr), rngState(seed ? seed : 1u) {}
+
+// Destructor: delete entire tree
+Treap::~Treap() {
+    deleteNodes(root);
+}
+
+// 1. addToTree - Insert a key with a random priority
+void Treap::addToTree(int key) {
+    if (contains(key))
+        return; // no duplicates
+    root = insertNode(root, new TreeNode(key, 1, 0, nullptr, nullptr, nextPriority()));
+}
+
+// 2. removeNode - Remove a key by joining its two subtrees
+bool Treap::removeNode(int key) {
+    bool removed = false;
+    root = removeNodeHelper(root, key, removed);
+    return removed;
+}
+
+// 3. getHeightOfTree - Get the height of the tree
+int Treap::getHeightOfTree() const {
+    return heightOf(root);
+}
+
+// 4. getNumberOfTreeNodes - subtree sizes are maintained, so this is O(1)
+int Treap::getNumberOfTreeNodes() const {
+    return sizeOf(root);
+}
+
+// 5. contains - Check if a key is in the tree
+bool Treap::contains(int key) const {
+    TreeNode* curr = root;
+    while (curr) {
+        if (key == curr->key)
+            return true;
+        else if (key < curr->key)
+            curr = curr->left;
+        else
+            curr = curr->right;
+    }
+    return false;
+}
+
+// 6. getRoot - Getter for the root node of the tree
+TreeNode* Treap::getRoot() const {
+    return root;
+}
+
+// 7. isEmpty - Check if the tree is empty
+bool Treap::isEmpty() const {
+    return root == nullptr;
+}
+
+// 8. clear - Removes tree
+void Treap::clear() {
+    deleteNodes(root);
+    root = nullptr;
+}
+
+// 9. split - move keys < key into left and keys >= key into right
+bool Treap::split(int key, Treap& left, Treap& right) {
+    if (&left == &right)
+        return false; // one treap cannot hold both halves
+    TreeNode* lower = nullptr;
+    TreeNode* upper = nullptr;
+    splitNodes(root, key, lower, upper);
+    root = nullptr;
+    left.clear();
+    right.clear();
+    left.root = lower;
+    right.root = upper;
+    return true;
+}
+
+// 10. join - concatenate two treaps whose ranges do not overlap
+bool Treap::join(Treap& left, Treap& right) {
+    if (&left == &right) {
+        // A non-empty treap always overlaps itself
+        if (!left.isEmpty())
+            return false;
+        clear();
+        return true;
+    }
+    if (left.root && right.root) {
+        const TreeNode* maxLeft = left.root;
+        while (maxLeft->right) maxLeft = maxLeft->right;
+        const TreeNode* minRight = right.root;
+        while (minRight->left) minRight = minRight->left;
+        if (maxLeft->key >= minRight->key)
+            return false;
+    }
+    TreeNode* lower = left.root;
+    TreeNode* upper = right.root;
+    left.root = nullptr;
+    right.root = nullptr;
+    clear();
+    root = joinNodes(lower, upper);
+    return true;
+}
+
+// 11. printNodeFromTree - print only the key of a node
+void Treap::printNodeFromTree(TreeNode* node) const {
+    if (!node) {
+        std::cout << "Node is null" << std::endl;
+        return;
+    }
+    std::cout << "Node key: " << node->key << std::endl;
+}
+
+// 12. printInOrder - print the tree in an in-order traversal
+void Treap::printInOrder() const {
+    std::cout << "Performing In-order traversal" << std::endl;
+    printInOrderHelper(root);
+}
+
+// 13. printPreOrder - print the tree in a Pre-order traversal
+void Treap::printPreOrder() const {
+    std::cout << "Performing Pre-order traversal" << std::endl;
+    printPreOrderHelper(root);
+}
+
+// 14. printPostOrder - print the tree in a Post-order traversal
+void Treap::printPostOrder() const {
+    std::cout << "Performing Post-order traversal" << std::endl;
+    printPostOrderHelper(root);
+}
+
+// 15. printDepthFirst - header only, no node dump
+void Treap::printDepthFirst() const {
+    std::cout << "Performing Depth First via PreOrder traversal" << std::endl;
+}
+
+// 16. printBreadthFirst - header only, no node dump
+void Treap::printBreadthFirst() const {
+    std::cout << "Performing Breadth First traversal" << std::endl;
+}
+
+// 17. nextPriority - xorshift32
+unsigned int Treap::nextPriority() {
+    unsigned int x = rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rngState = x;
+    return x;
+}
+
+// File-local: size of a possibly empty subtree
+static int sizeOf(const TreeNode* node) {
+    return node ? node->numberOfNodes : 0;
+}
+
+// File-local: recompute the subtree size after a child changed
+static void update(TreeNode* node) {
+    node->numberOfNodes = 1 + sizeOf(node->left) + sizeOf(node->right);
+}
+
+// File-local: split subtree into keys < key and keys >= key
+static void splitNodes(TreeNode* node, int key, TreeNode*& left, TreeNode*& right) {
+    if (!node) {
+        left = right = nullptr;
+        return;
+    }
+    if (node->key < key) {
+        splitNodes(node->right, key, node->right, right);
+        left = node;
+    } else {
+        splitNodes(node->left, key, left, node->left);
+        right = node;
+    }
+    update(node);
+}
+
+// File-local: join two subtrees where every key in left < every key in right
+static TreeNode* joinNodes(TreeNode* left, TreeNode* right) {
+    if (!left) return right;
+    if (!right) return left;
+    if (left->priority > right->priority) {
+        left->right = joinNodes(left->right, right);
+        update(left);
+        return left;
+    }
+    right->left = joinNodes(left, right->left);
+    update(right);
+    return right;
+}
+
+// File-local: descend until the heap order says fresh belongs here, then split
+static TreeNode* insertNode(TreeNode* node, TreeNode* fresh) {
+    if (!node)
+        return fresh;
+    if (fresh->priority > node->priority) {
+        splitNodes(node, fresh->key, fresh->left, fresh->right);
+        update(fresh);
+        return fresh;
+    }
+    if (fresh->key < node->key)
+        node->left = insertNode(node->left, fresh);
+    else
+        node->right = insertNode(node->right, fresh);
+    update(node);
+    return node;
+}
+
+// File-local: remove a key and join its children in its place
+static TreeNode* removeNodeHelper(TreeNode* node, int key, bool& removed) {
+    if (!node) return nullptr;
+    if (key < node->key) {
+        node->left = removeNodeHelper(node->left, key, removed);
+    } else if (key > node->key) {
+        node->right = removeNodeHelper(node->right, key, removed);
+    } else {
+        removed = true;
+        TreeNode* joined = joinNodes(node->left, node->right);
+        delete node;
+        return joined;
+    }
+    if (removed)
+        update(node);
+    return node;
+}
+
+// File-local: delete a subtree
+static void deleteNodes(TreeNode* node) {
+    if (!node) return;
+    deleteNodes(node->left);
+    deleteNodes(node->right);
+    delete node;
+}
+
+// File-local: height of a subtree
+static int heightOf(const TreeNode* node) {
+    if (!node) return 0;
+    int lh = heightOf(node->left);
+    int rh = heightOf(node->right);
+    return 1 + (lh > rh ? lh : rh);
+}
+
+// File-local: recursive in-order
+static void printInOrderHelper(const TreeNode* node) {
+    if (!node) return;
+    printInOrderHelper(node->left);
+    std::cout << "Node key: " << node->key << std::endl;
+    printInOrderHelper(node->right);
+}
+
+// File-local: recursive pre-order
+static void printPreOrderHelper(const TreeNode* node) {
+    if (!node) return;
+    std::cout << "Node key: " << node->key << std::endl;
+    printPreOrderHelper(node->left);
+    printPreOrderHelper(node->right);
+}
+
+// File-local: recursive post-order
+static void printPostOrderHelper(const TreeNode* node) {
+    if (!node) return;
+    printPostOrderHelper(node->left);
+    printPostOrderHelper(node->right);
+    std::cout << "Node key: " << node->key << std::endl;
+}
@@ -0,0 +1,178 @@
+/**
+* @author - Hugh Hui
+* @file treap.h -  This header file declares the methods in the treap.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef TREAP_H
+#define TREAP_H
+
+#include "tree_node.h"
+
+/**
+ * @class Treap
+ * @brief A randomized balanced binary search tree with split and join.
+ *
+ * Each node carries a random `priority` and the tree is a max-heap on
+ * priorities, which keeps the expected height O(log n). `numberOfNodes` is
+ * kept up to date in every node. The same heap structure gives O(log n)
+ * `split` and `join`, so key ranges can be moved between treaps without
+ * reinserting them one by one. Traversal output matches BinarySearchTree.
+ */
+class Treap {
+public:
+    /**
+     * @brief Default constructor for Treap.
+     *
+     * Initializes an empty treap.
+     *
+     * @param seed Seed for the priority generator (default is a fixed value,
+     *             so runs are reproducible).
+     */
+    explicit Treap(unsigned int seed = 0x9E3779B9u);
+
+    /**
+     * @brief Destructor for Treap.
+     *
+     * Frees the dynamically allocated memory by deleting all nodes in the tree.
+     */
+    ~Treap();
+
+    Treap(const Treap&) = delete;
+    Treap& operator=(const Treap&) = delete;
+
+    /**
+     * @brief Adds a node with the specified key to the tree.
+     *
+     * @param key The key to be added to the tree.
+     */
+    void addToTree(int key);
+
+    /**
+     * @brief Removes a node with the specified key from the tree.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the node was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Gets the height of the tree.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree() const;
+
+    /**
+     * @brief Gets the number of nodes in the tree in O(1).
+     *
+     * @return The number of nodes in the tree.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Checks if the tree contains a node with the specified key.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key) const;
+
+    /**
+     * @brief Gets the root node of the tree.
+     *
+     * @return A pointer to the root node of the tree.
+     */
+    TreeNode* getRoot() const;
+
+    /**
+     * @brief Checks if the tree is empty.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Clears the entire tree.
+     *
+     * Deletes all the nodes in the tree, freeing up memory.
+     */
+    void clear();
+
+    /**
+     * @brief Splits this treap around a key in O(log n) expected time.
+     *
+     * All nodes move out of this treap: keys less than `key` go to `left`
+     * and keys greater than or equal to `key` go to `right`. Any previous
+     * contents of `left` and `right` are deleted first. Either output may
+     * be this treap itself, but `left` and `right` must be different
+     * treaps, since one treap cannot hold both halves.
+     *
+     * @param key The split key.
+     * @param left Receives the keys less than `key`.
+     * @param right Receives the keys greater than or equal to `key`.
+     * @return True if the treap was split, false if `left` and `right` are
+     *         the same treap (nothing is changed in that case).
+     */
+    bool split(int key, Treap& left, Treap& right);
+
+    /**
+     * @brief Joins two treaps whose key ranges do not overlap, in O(log n) expected time.
+     *
+     * Every key in `left` must be less than every key in `right`. On success
+     * this treap holds all nodes of both inputs and the inputs are left empty.
+     * Any previous contents of this treap are deleted first, unless it is one
+     * of the inputs.
+     *
+     * @param left The treap holding the smaller keys.
+     * @param right The treap holding the larger keys.
+     * @return True if the treaps were joined, false if their key ranges
+     *         overlap (nothing is changed in that case).
+     */
+    bool join(Treap& left, Treap& right);
+
+    /**
+     * @brief Prints the key of a specific node.
+     *
+     * @param node A pointer to the node whose data is to be printed.
+     */
+    void printNodeFromTree(TreeNode* node) const;
+
+    /**
+     * @brief Performs an in-order traversal of the tree and prints the nodes.
+     */
+    void printInOrder() const;
+
+    /**
+     * @brief Performs a pre-order traversal of the tree and prints the nodes.
+     */
+    void printPreOrder() const;
+
+    /**
+     * @brief Performs a post-order traversal of the tree and prints the nodes.
+     */
+    void printPostOrder() const;
+
+    /**
+     * @brief Prints the depth-first traversal header, as BinarySearchTree does.
+     */
+    void printDepthFirst() const;
+
+    /**
+     * @brief Prints the breadth-first traversal header, as BinarySearchTree does.
+     */
+    void printBreadthFirst() const;
+
+private:
+    TreeNode* root;         /**< Pointer to the root node of the tree */
+    unsigned int rngState;  /**< xorshift32 state for node priorities */
+
+    /**
+     * @brief Draws the next node priority.
+     *
+     * @return A pseudo-random priority.
+     */
+    unsigned int nextPriority();
+};
+
+#endif // TREAP_H
@@ -0,0 +1,55 @@
+/**
+* @author - Hugh Hui
+* @file tree_iterator.cpp - Stack-based in-order iterator over TreeNode trees.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "tree_iterator.h"
+
+// Constructor: descend to the smallest key
+InOrderIterator::InOrderIterator(const TreeNode* root) {
+    pushLeft(root);
+}
+
+// Constructor: descend to the key of the given rank using subtree sizes
+InOrderIterator::InOrderIterator(const TreeNode* root, int rank) {
+    const TreeNode* node = root;
+    while (node) {
+        int leftSize = node->left ? node->left->numberOfNodes : 0;
+        if (rank < leftSize) {
+            pending.push_back(node); // visited after its left subtree
+            node = node->left;
+        } else if (rank == leftSize) {
+            pending.push_back(node);
+            break;
+        } else {
+            rank -= leftSize + 1; // node and its left subtree come before the rank
+            node = node->right;
+        }
+    }
+}
+
+// 1. hasNext - keys remain while the stack is not empty
+bool InOrderIterator::hasNext() const {
+    return !pending.empty();
+}
+
+// 2. peek - the top of the stack is the next key
+int InOrderIterator::peek() const {
+    return pending.back()->key;
+}
+
+// 3. next - pop the next key and queue its right subtree
+int InOrderIterator::next() {
+    const TreeNode* node = pending.back();
+    pending.pop_back();
+    pushLeft(node->right);
+    return node->key;
+}
+
+// 4. pushLeft - push node and all its left descendants
+void InOrderIterator::pushLeft(const TreeNode* node) {
+    while (node) {
+        pending.push_back(node);
+        node = node->left;
+    }
+}
@@ -0,0 +1,74 @@
+/**
+* @author - Hugh Hui
+* @file tree_iterator.h -  This header file declares the methods in the tree_iterator.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+* 10/19/2026 - H. Hui added a constructor that starts at a rank
+*/
+
+#ifndef TREEITERATOR_H
+#define TREEITERATOR_H
+
+#include <vector>
+#include "tree_node.h"
+
+/**
+ * @class InOrderIterator
+ * @brief Streams the keys of a tree in ascending order.
+ *
+ * The iterator keeps an explicit stack of the left spine still to visit, so
+ * it uses O(height) memory and never recurses. Each `next` call is amortized
+ * O(1). The tree must not be modified while an iterator is in use.
+ */
+class InOrderIterator {
+public:
+    /**
+     * @brief Constructs an iterator positioned at the smallest key.
+     *
+     * @param root The root of the tree to walk (may be nullptr).
+     */
+    explicit InOrderIterator(const TreeNode* root);
+
+    /**
+     * @brief Constructs an iterator positioned at the key of a given rank.
+     *
+     * Uses the `numberOfNodes` subtree sizes to get there in O(height).
+     * A rank at or past the number of keys gives an exhausted iterator.
+     *
+     * @param root The root of the tree to walk (may be nullptr).
+     * @param rank 0-based position in ascending key order.
+     */
+    InOrderIterator(const TreeNode* root, int rank);
+
+    /**
+     * @brief Checks if there are keys left to visit.
+     *
+     * @return True if `next` may be called, false otherwise.
+     */
+    bool hasNext() const;
+
+    /**
+     * @brief Gets the next key without advancing.
+     *
+     * @return The next key in ascending order.
+     */
+    int peek() const;
+
+    /**
+     * @brief Advances the iterator.
+     *
+     * @return The next key in ascending order.
+     */
+    int next();
+
+private:
+    std::vector<const TreeNode*> pending; /**< Left spine of the unvisited part */
+
+    /**
+     * @brief Pushes a node and its chain of left children.
+     *
+     * @param node The node to start from.
+     */
+    void pushLeft(const TreeNode* node);
+};
+
+#endif // TREEITERATOR_H
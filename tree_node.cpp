@@ -6,6 +6,7 @@
 * 1/14/2025 - H. Hui created file and added comments.
 * 1/15/2025 - modified by H. Hui; modified remove methods; added comments
 * 2/1/2025 - H. Hui added doxygen formatted comments
+* 10/19/2026 - H. Hui added priority for the treap engine
 *
 * This constructor initializes a TreeNode object with the provided key, number of nodes,
 * height, and pointers to the left and right children.
@@ -15,9 +16,10 @@
 * @param h The height of the node in the tree.
 * @param l Pointer to the left child node.
 * @param r Pointer to the right child node.
+* @param p Heap priority of the node (treap engine only).
 *
 */
 #include "tree_node.h"
 
-TreeNode::TreeNode(int k, int numNodes, int h, TreeNode* l, TreeNode* r)
-    : key(k), numberOfNodes(numNodes), height(h), left(l), right(r) {}
+TreeNode::TreeNode(int k, int numNodes, int h, TreeNode* l, TreeNode* r, unsigned int p)
+    : key(k), numberOfNodes(numNodes), height(h), priority(p), left(l), right(r) {}
@@ -4,13 +4,14 @@
 * 1/14/2025 - H. Hui created file and added comments.
 * 1/15/2025 - modified by H. Hui; modified remove methods; added comments
 * 2/1/2025 - H. Hui added doxygen formatted comments
+* 10/19/2026 - H. Hui added priority field for the treap engine
 * 
  * @brief Declaration of the TreeNode structure used for Binary Search Tree.
  *
  * This header file defines the TreeNode structure which is used in the
  * construction of a binary tree. Each TreeNode contains a key, the number of
- * nodes in its subtree, the height of the node, and pointers to its left and
- * right children.
+ * nodes in its subtree, the height of the node, a heap priority used by the
+ * treap engine, and pointers to its left and right children.
  */
 
 #ifndef TREENODE_H
@@ -28,6 +29,7 @@ struct TreeNode {
     int key;                /**< Key for the tree node. */
     int numberOfNodes;      /**< Total nodes in the subtree rooted at this node. */
     int height;             /**< Height of the node in the tree. */
+    unsigned int priority;  /**< Heap priority; only used by the treap engine. Fills the padding before `left`. */
     TreeNode* left;         /**< Pointer to the left child. */
     TreeNode* right;        /**< Pointer to the right child. */
 
@@ -43,8 +45,9 @@ struct TreeNode {
      * @param h The height of the node (default is 0).
      * @param l Pointer to the left child (default is nullptr).
      * @param r Pointer to the right child (default is nullptr).
+     * @param p Heap priority of the node (default is 0).
      */
-    TreeNode(int k = 0, int numNodes = 1, int h = 0, TreeNode* l = nullptr, TreeNode* r = nullptr);
+    TreeNode(int k = 0, int numNodes = 1, int h = 0, TreeNode* l = nullptr, TreeNode* r = nullptr, unsigned int p = 0);
 };
 
 #endif // TREENODE_H
@@ -0,0 +1,130 @@
+/**
+* @author - Hugh Hui
+* @file work_stealing_pool.cpp - Fork-join thread pool with per-worker deques and stealing.
+* 10/19/2026 - H. Hui created file and added comments.
+*/
+#include "work_stealing_pool.h"
+
+// Pool and queue index of the current thread, if it is a worker
+static thread_local const WorkStealingPool* currentPool = nullptr;
+static thread_local int currentQueue = -1;
+
+// Constructor: one queue per worker plus the shared queue
+WorkStealingPool::WorkStealingPool(int threads)
+    : numberOfThreads(threads), queued(0), stopping(false), parkedWaiters(0) {
+    if (numberOfThreads <= 0) {
+        unsigned int hardware = std::thread::hardware_concurrency();
+        numberOfThreads = hardware > 0 ? static_cast<int>(hardware) : 1;
+    }
+    queues.reset(new TaskQueue[numberOfThreads + 1]);
+    for (int i = 0; i < numberOfThreads; ++i)
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+// Destructor: drain, then join
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> guard(idleMutex);
+        stopping.store(true);
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+// 1. spawn - push to the back of the caller's queue and wake a sleeper
+void WorkStealingPool::spawn(std::function<void()> task) {
+    TaskQueue& queue = queues[queueOfCaller()];
+    {
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(std::move(task));
+    }
+    queued.fetch_add(1);
+    bool waitersParked;
+    {
+        // Taking the lock orders the count against a worker about to sleep
+        std::lock_guard<std::mutex> guard(idleMutex);
+        waitersParked = parkedWaiters > 0;
+    }
+    wakeUp.notify_one();
+    if (waitersParked)
+        progress.notify_all();
+}
+
+// 2. waitFor - help out until the counter reaches zero, sleeping while others finish
+void WorkStealingPool::waitFor(const std::atomic<int>& pending) {
+    const int SPIN_LIMIT = 64;
+    int self = queueOfCaller();
+    int spins = 0;
+    while (pending.load(std::memory_order_acquire) > 0) {
+        if (runOne(self)) {
+            spins = 0;
+        } else if (++spins < SPIN_LIMIT) {
+            std::this_thread::yield();
+        } else {
+            // The remaining tasks run elsewhere; runOne notifies after each one
+            std::unique_lock<std::mutex> guard(idleMutex);
+            ++parkedWaiters;
+            progress.wait(guard, [&] { return pending.load(std::memory_order_acquire) == 0 || queued.load() > 0; });
+            --parkedWaiters;
+            spins = 0;
+        }
+    }
+}
+
+// 3. getNumberOfThreads - Getter for the worker count
+int WorkStealingPool::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+// 4. queueOfCaller - own queue for workers, shared queue for everyone else
+int WorkStealingPool::queueOfCaller() const {
+    return currentPool == this ? currentQueue : numberOfThreads;
+}
+
+// 5. runOne - own back first, then the fronts of the other queues
+bool WorkStealingPool::runOne(int self) {
+    std::function<void()> task;
+    {
+        TaskQueue& own = queues[self];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+        }
+    }
+    for (int i = 1; !task && i <= numberOfThreads; ++i) {
+        TaskQueue& victim = queues[(self + i) % (numberOfThreads + 1)];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    if (!task)
+        return false;
+    queued.fetch_sub(1);
+    task();
+    {
+        // The task has counted itself done; the lock orders that against a waiter about to sleep
+        std::lock_guard<std::mutex> guard(idleMutex);
+        if (parkedWaiters == 0)
+            return true;
+    }
+    progress.notify_all();
+    return true;
+}
+
+// 6. workerLoop - run tasks, sleep while nothing is queued
+void WorkStealingPool::workerLoop(int self) {
+    currentPool = this;
+    currentQueue = self;
+    while (true) {
+        if (runOne(self))
+            continue;
+        std::unique_lock<std::mutex> guard(idleMutex);
+        wakeUp.wait(guard, [this] { return queued.load() > 0 || stopping.load(); });
+        if (stopping.load() && queued.load() == 0)
+            return;
+    }
+}
@@ -0,0 +1,115 @@
+/**
+* @author - Hugh Hui
+* @file work_stealing_pool.h -  This header file declares the methods in the work_stealing_pool.cpp file.
+* 10/19/2026 - H. Hui created file and added doxygen formatted comments
+*/
+
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class WorkStealingPool
+ * @brief A fork-join thread pool where idle threads steal queued tasks from busy ones.
+ *
+ * Each worker has its own deque. A task spawned on a worker goes to the back
+ * of that worker's deque, and the worker takes its own work from the back,
+ * so it stays on recently touched data. Idle workers steal from the front of
+ * other deques, where the oldest and usually largest tasks are. Tasks spawned
+ * from threads outside the pool go to a shared queue that anyone may take from.
+ *
+ * `waitFor` runs queued tasks while it waits. A task may therefore spawn
+ * subtasks and wait for them without tying up a thread. When nothing is left
+ * to run but a stolen task is still going, it sleeps until a task finishes.
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param threads Number of workers (0 means one per hardware thread).
+     */
+    explicit WorkStealingPool(int threads = 0);
+
+    /**
+     * @brief Stops the workers once their queues are empty.
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * @brief Queues a task.
+     *
+     * @param task The task to run on some pool thread, or on a thread in `waitFor`.
+     */
+    void spawn(std::function<void()> task);
+
+    /**
+     * @brief Runs queued tasks until a counter drops to zero.
+     *
+     * @param pending Number of outstanding tasks; each one decrements it
+     *                with release ordering as it finishes, inside the task.
+     */
+    void waitFor(const std::atomic<int>& pending);
+
+    /**
+     * @brief Gets the number of worker threads.
+     *
+     * @return The number of workers.
+     */
+    int getNumberOfThreads() const;
+
+private:
+    /**
+     * @struct TaskQueue
+     * @brief One worker's deque, on its own cache line.
+     */
+    struct alignas(64) TaskQueue {
+        std::mutex lock;                            /**< Guards tasks */
+        std::deque<std::function<void()>> tasks;    /**< Owner uses the back, thieves the front */
+    };
+
+    int numberOfThreads;                    /**< Number of workers */
+    std::unique_ptr<TaskQueue[]> queues;    /**< One per worker, plus the shared queue last */
+    std::vector<std::thread> workers;       /**< Worker threads */
+    std::atomic<int> queued;                /**< Tasks queued anywhere; lets idle workers sleep */
+    std::atomic<bool> stopping;             /**< Set by the destructor */
+    std::mutex idleMutex;                   /**< Pairs with wakeUp and progress */
+    std::condition_variable wakeUp;         /**< Signals queued work or shutdown */
+    std::condition_variable progress;       /**< Signals a finished task or queued work to waitFor */
+    int parkedWaiters;                      /**< Threads asleep in waitFor; guarded by idleMutex */
+
+    /**
+     * @brief Index of the calling thread's queue.
+     *
+     * @return The worker index, or the shared queue's index for outside threads.
+     */
+    int queueOfCaller() const;
+
+    /**
+     * @brief Takes one task, own queue first, then steals, and runs it.
+     *
+     * @param self Index of the caller's queue.
+     * @return True if a task was run.
+     */
+    bool runOne(int self);
+
+    /**
+     * @brief Body of each worker thread.
+     *
+     * @param self The worker's index.
+     */
+    void workerLoop(int self);
+};
+
+#endif // WORKSTEALINGPOOL_H